@@ -0,0 +1,259 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/batched_kalman_fitter.hpp"
+#include "common/telescope_track_finding.hpp"
+
+// traccc include(s).
+#include "traccc/fitting/kalman_fitting_algorithm.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Largest chi2/NDF difference of a track from the one-lane fit, relative
+/// to its chi2/NDF (or to 1, if that is smaller)
+///
+/// The lanes run the operations of the scalar code, so only a different
+/// contraction into FMA instructions separates them.
+///
+constexpr double max_lane_chi2_ndf_difference = 1e-4;
+
+/// Largest chi2/NDF difference of a track from traccc's Kalman fitter
+///
+/// The batched fitter has its own transport and scattering model, which is
+/// specialised to the telescope, so its chi2 can not be identical to
+/// traccc's. A track that differs by more than this is a failed fit of one
+/// of the two.
+///
+constexpr double max_traccc_chi2_ndf_difference = 1.;
+
+/// Largest difference of a smoothed parameter from the full fit's, in units
+/// of its uncertainty
+///
+/// The track finding applies the filter steps of the fitter, so the
+/// smoothed states only differ by the rounding of the scalar and the vector
+/// code.
+///
+constexpr double max_smoothed_pull_difference = 1e-3;
+
+}  // namespace
+
+/// Kalman fitting time of traccc's host fitter, on the same tracks as @c
+/// BM_batched_kalman_fitting
+///
+/// The argument is the number of particles per event.
+///
+static void BM_traccc_kalman_fitting(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+    const auto track_candidates_data =
+        traccc::get_data(products.track_candidates);
+    const host::kalman_fitting_algorithm fitting(setup.config().fitting,
+                                                 input.mr);
+
+    for (auto _ : state) {
+        auto track_states =
+            fitting(setup.detector(), setup.field(), track_candidates_data);
+        benchmark::DoNotOptimize(track_states.size());
+    }
+
+    state.counters["tracks"] =
+        static_cast<double>(products.track_candidates.size());
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(products.track_candidates.size()));
+}
+BENCHMARK(BM_traccc_kalman_fitting)
+    ->ArgName("particles")
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Unit(benchmark::kMillisecond);
+
+/// Batched Kalman fitting time as a function of the number of tracks
+///
+/// The template argument is the number of tracks fitted at once; one lane is
+/// the scalar code of the batched fitter. Besides the timing, every
+/// benchmark reports the mean chi2/NDF, the largest difference of the
+/// chi2/NDF of any track from the one-lane fit, and the largest and mean
+/// per-track difference from traccc's host Kalman fitter (timed by @c
+/// BM_traccc_kalman_fitting). Tracks that differ from either by more than
+/// @c max_lane_chi2_ndf_difference or @c max_traccc_chi2_ndf_difference are
+/// "mismatched".
+///
+template <std::size_t LANES>
+static void BM_batched_kalman_fitting(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+
+    const tutorial::batched_fitter_config fit_cfg;
+    const tutorial::batched_kalman_fitter<LANES> fitter(
+        fit_cfg, setup.modules(), setup.config().B);
+    const tutorial::batched_kalman_fitter<1u> scalar_fitter(
+        fit_cfg, setup.modules(), setup.config().B);
+
+    for (auto _ : state) {
+        auto track_states = fitter(products.track_candidates);
+        benchmark::DoNotOptimize(track_states.data());
+    }
+
+    // Compare with the one-lane path and with traccc's fitter
+    const auto batched = fitter(products.track_candidates);
+    const auto scalar = scalar_fitter(products.track_candidates);
+    const host::kalman_fitting_algorithm traccc_fitting(
+        setup.config().fitting, input.mr);
+    const auto reference =
+        traccc_fitting(setup.detector(), setup.field(),
+                       traccc::get_data(products.track_candidates));
+    double max_difference = 0., chi2_sum = 0.;
+    double max_traccc_difference = 0., traccc_difference_sum = 0.;
+    std::size_t n_fitted = 0, n_compared = 0, mismatched = 0;
+    for (std::size_t i = 0; i < batched.size(); ++i) {
+        if (batched[i].ndf == 0u) {
+            mismatched += (scalar[i].ndf != 0u);
+            continue;
+        }
+        const double ndf = static_cast<double>(batched[i].ndf);
+        const double lane_difference =
+            std::abs(batched[i].chi2 - scalar[i].chi2) / ndf;
+        max_difference = std::max(max_difference, lane_difference);
+        mismatched += (batched[i].ndf != scalar[i].ndf ||
+                       lane_difference >
+                           max_lane_chi2_ndf_difference *
+                               std::max(batched[i].chi2 / ndf, 1.));
+        chi2_sum += batched[i].chi2 / ndf;
+        ++n_fitted;
+
+        const auto& traccc_fit = reference.at(i).header;
+        if (!(traccc_fit.ndf > 0.f)) {
+            continue;
+        }
+        const double difference =
+            std::abs(batched[i].chi2 / ndf -
+                     static_cast<double>(traccc_fit.chi2 / traccc_fit.ndf));
+        max_traccc_difference = std::max(max_traccc_difference, difference);
+        traccc_difference_sum += difference;
+        ++n_compared;
+        mismatched += (difference > max_traccc_chi2_ndf_difference);
+    }
+
+    state.counters["tracks"] =
+        static_cast<double>(products.track_candidates.size());
+    state.counters["chi2_ndf"] =
+        chi2_sum / static_cast<double>(std::max<std::size_t>(n_fitted, 1u));
+    state.counters["max_chi2_ndf_diff"] = max_difference;
+    state.counters["max_chi2_ndf_diff_traccc"] = max_traccc_difference;
+    state.counters["mean_chi2_ndf_diff_traccc"] =
+        traccc_difference_sum /
+        static_cast<double>(std::max<std::size_t>(n_compared, 1u));
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(products.track_candidates.size()));
+}
+BENCHMARK_TEMPLATE(BM_batched_kalman_fitting, 1)
+    ->ArgName("particles")
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_batched_kalman_fitting, 4)
+    ->ArgName("particles")
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_batched_kalman_fitting, 8)
+    ->ArgName("particles")
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Unit(benchmark::kMillisecond);
+
+/// Smoothing of the filter states handed over by the track finding
+///
+/// The candidates of the telescope track finding are fitted by the batched
+/// fitter either from scratch, or by only smoothing the forward filter states
+/// that the track finding handed over (which is what is timed). The largest
+/// difference of the chi2/NDF between the two is reported, and should vanish.
+/// Tracks whose chi2/NDF differs by more than @c max_lane_chi2_ndf_difference,
+/// or whose smoothed parameters differ by more than @c
+/// max_smoothed_pull_difference of their uncertainty, are "mismatched".
+///
+static void BM_filtered_smoothing(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+
+    const tutorial::batched_fitter_config fit_cfg;
+    const tutorial::telescope_track_finding finding(
+        tutorial::telescope_finding_config{}, fit_cfg, setup.modules(),
+        setup.config().B, input.mr);
+    std::vector<tutorial::filtered_track<double>> filtered;
+    const auto candidates =
+        finding(products.measurements, products.measurement_ranges,
+                products.params, &filtered);
+    const tutorial::batched_kalman_fitter<8u> fitter(fit_cfg, setup.modules(),
+                                                     setup.config().B);
+
+    for (auto _ : state) {
+        auto track_states = fitter.smooth_filtered(filtered);
+        benchmark::DoNotOptimize(track_states.data());
+    }
+
+    // Compare with the full fit of the same candidates
+    const auto smoothed = fitter.smooth_filtered(filtered);
+    const auto fitted = fitter(candidates);
+    double max_difference = 0.;
+    std::size_t mismatched = 0;
+    for (std::size_t i = 0; i < fitted.size(); ++i) {
+        if (fitted[i].ndf == 0u) {
+            mismatched += (smoothed[i].ndf != 0u);
+            continue;
+        }
+        const double ndf = static_cast<double>(fitted[i].ndf);
+        const double difference =
+            std::abs(smoothed[i].chi2 - fitted[i].chi2) / ndf;
+        max_difference = std::max(max_difference, difference);
+        bool mismatch =
+            (smoothed[i].ndf != fitted[i].ndf ||
+             smoothed[i].x != fitted[i].x ||
+             difference > max_lane_chi2_ndf_difference *
+                              std::max(fitted[i].chi2 / ndf, 1.));
+        for (std::size_t k = 0; k < fitted[i].params.size(); ++k) {
+            const double sigma =
+                std::sqrt(static_cast<double>(fitted[i].covariance[k * 6u]));
+            mismatch |= !(std::abs(smoothed[i].params[k] -
+                                   fitted[i].params[k]) <=
+                          max_smoothed_pull_difference * sigma);
+        }
+        mismatched += mismatch;
+    }
+
+    state.counters["tracks"] = static_cast<double>(candidates.size());
+    state.counters["max_chi2_ndf_diff"] = max_difference;
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(candidates.size()));
+}
+BENCHMARK(BM_filtered_smoothing)
+    ->ArgName("particles")
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Unit(benchmark::kMillisecond);
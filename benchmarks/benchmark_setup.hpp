@@ -0,0 +1,162 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/detector_utils.hpp"
+#include "common/event_generator.hpp"
+#include "common/reconstruction_chain.hpp"
+#include "common/stage_timer.hpp"
+
+// detray include(s).
+#include "detray/detectors/bfield.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Event-independent data shared by all benchmarks
+///
+/// The geometry is read only once per benchmark executable, the first time
+/// any benchmark asks for it.
+///
+class benchmark_setup {
+
+    public:
+    /// The single instance of the setup
+    static const benchmark_setup& instance() {
+        static const benchmark_setup setup;
+        return setup;
+    }
+
+    /// Generate an event with @c n_particles particles
+    generated_event generate(std::size_t n_particles,
+                             vecmem::memory_resource& mr) const {
+        generator_config cfg = m_gen_cfg;
+        cfg.n_particles = n_particles;
+        const event_generator generator(cfg, m_modules, m_readout, m_cfg.B);
+        return generator(0u, mr);
+    }
+
+    /// Run the full chain on an event, to provide the inputs of a stage
+    chain_result reconstruct(const generated_event& event,
+                             vecmem::memory_resource& mr) const {
+        const reconstruction_chain chain(m_cfg, detector(), m_dd, m_field,
+                                         mr);
+        stage_times times;
+        return chain(event.cells, times);
+    }
+
+    /// @name Accessors
+    /// @{
+    const chain_config& config() const { return m_cfg; }
+    const reconstruction_chain::detector_type& detector() const {
+        return m_det.first;
+    }
+    const silicon_detector_description::host& detector_description() const {
+        return m_dd;
+    }
+    const reconstruction_chain::field_type& field() const { return m_field; }
+    std::size_t n_modules() const { return m_modules.size(); }
+    const std::vector<module_placement>& modules() const { return m_modules; }
+    /// @}
+
+    private:
+    benchmark_setup()
+        : m_det(read_telescope_detector(m_mr)),
+          m_modules(sensitive_modules(m_det.first)),
+          m_dd(make_detector_description(m_modules, m_mr, m_readout)),
+          m_field(detray::bfield::create_const_field(m_cfg.B)) {
+        // Clusters of a few pixels, as in a real pixel detector
+        m_gen_cfg.cluster_radius = 60.f * unit<scalar>::um;
+    }
+
+    vecmem::host_memory_resource m_mr;
+    chain_config m_cfg;
+    pixel_readout m_readout;
+    generator_config m_gen_cfg;
+    decltype(read_telescope_detector(m_mr)) m_det;
+    std::vector<module_placement> m_modules;
+    silicon_detector_description::host m_dd;
+    reconstruction_chain::field_type m_field;
+
+};  // class benchmark_setup
+
+/// Generated event of a benchmark, with the memory resource it lives in
+///
+/// The number of particles is the first argument of the benchmark, unless
+/// it is given explicitly. The products of the full chain, which most
+/// stages need as their input, are only reconstructed when they are asked
+/// for, as that takes long for large events.
+///
+struct benchmark_event {
+
+    /// Generate the event of benchmark @c state
+    explicit benchmark_event(const benchmark::State& state)
+        : benchmark_event(static_cast<std::size_t>(state.range(0))) {}
+
+    /// Generate an event with @c n_particles particles
+    explicit benchmark_event(std::size_t n_particles)
+        : event(benchmark_setup::instance().generate(n_particles, mr)) {}
+
+    benchmark_event(const benchmark_event&) = delete;
+    benchmark_event& operator=(const benchmark_event&) = delete;
+
+    /// Products of the full chain on the event, reconstructed on first use
+    const chain_result& products() {
+        if (!m_products) {
+            m_products.emplace(
+                benchmark_setup::instance().reconstruct(event, mr));
+        }
+        return *m_products;
+    }
+
+    /// Memory resource of the event, and of the benchmarked algorithms
+    vecmem::host_memory_resource mr;
+    /// The generated event
+    generated_event event;
+
+    private:
+    std::optional<chain_result> m_products;
+
+};  // struct benchmark_event
+
+/// Whether any benchmark of the run produced wrong results
+inline bool& benchmarks_failed() {
+    static bool failed = false;
+    return failed;
+}
+
+/// Report the results of a benchmark that differ from their reference
+///
+/// The number is reported as the "mismatched" counter. Any mismatch fails
+/// the benchmark, and makes the benchmark executable return an error, so
+/// that a regression in the results is caught wherever the benchmarks run.
+///
+inline void check_mismatches(benchmark::State& state,
+                             std::size_t mismatched) {
+    state.counters["mismatched"] = static_cast<double>(mismatched);
+    if (mismatched > 0u) {
+        const std::string message =
+            std::to_string(mismatched) + " results differ from the reference";
+        state.SkipWithError(message.c_str());
+        benchmarks_failed() = true;
+    }
+}
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,133 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/parallel_clusterization.hpp"
+#include "common/thread_pool.hpp"
+
+// traccc include(s).
+#include "traccc/clusterization/clusterization_algorithm.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <tuple>
+
+using namespace traccc;
+
+/// Clusterization time as a function of the cell occupancy
+///
+/// The argument is the number of particles per event. The number of cells
+/// per module is reported as the "occupancy" counter.
+///
+static void BM_clusterization(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto dd_data = vecmem::get_data(setup.detector_description());
+
+    host::clusterization_algorithm ca(input.mr);
+
+    for (auto _ : state) {
+        auto measurements = ca(vecmem::get_data(input.event.cells), dd_data);
+        benchmark::DoNotOptimize(measurements.data());
+    }
+
+    const auto n_cells = static_cast<double>(input.event.cells.size());
+    state.counters["cells"] = n_cells;
+    state.counters["occupancy"] =
+        n_cells / static_cast<double>(setup.n_modules());
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(input.event.cells.size()));
+}
+BENCHMARK(BM_clusterization)
+    ->RangeMultiplier(4)
+    ->Range(16, 16384)
+    ->Unit(benchmark::kMillisecond);
+
+namespace {
+
+/// Largest difference between two sets of measurements, and the number of
+/// measurements without a counterpart
+std::pair<double, std::size_t> compare_measurements(
+    measurement_collection_types::host a,
+    measurement_collection_types::host b) {
+
+    const auto less = [](const measurement& x, const measurement& y) {
+        return std::tie(x.surface_link, x.local[0], x.local[1]) <
+               std::tie(y.surface_link, y.local[0], y.local[1]);
+    };
+    std::sort(a.begin(), a.end(), less);
+    std::sort(b.begin(), b.end(), less);
+    double max_distance = 0.;
+    std::size_t mismatched =
+        std::max(a.size(), b.size()) - std::min(a.size(), b.size());
+    for (std::size_t i = 0; i < std::min(a.size(), b.size()); ++i) {
+        if (a[i].surface_link != b[i].surface_link) {
+            ++mismatched;
+            continue;
+        }
+        max_distance = std::max(
+            {max_distance,
+             static_cast<double>(std::abs(a[i].local[0] - b[i].local[0])),
+             static_cast<double>(std::abs(a[i].local[1] - b[i].local[1]))});
+    }
+    return {max_distance, mismatched};
+}
+
+}  // namespace
+
+/// Module-parallel clusterization time as a function of the occupancy
+///
+/// The arguments are the number of particles per event and the number of
+/// threads. The measurements are compared with those of traccc's
+/// clusterization algorithm, reported as the "max_distance_um" and
+/// "mismatched" counters.
+///
+static void BM_parallel_clusterization(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto dd_data = vecmem::get_data(setup.detector_description());
+
+    // Small tasks, so that the five telescope modules are spread over the
+    // threads
+    tutorial::parallel_clusterization_config cfg;
+    cfg.min_cells_per_task = 1u;
+    std::optional<tutorial::thread_pool> pool;
+    if (state.range(1) > 1) {
+        pool.emplace(static_cast<std::size_t>(state.range(1)));
+    }
+    const tutorial::parallel_clusterization ca(input.mr,
+                                               pool ? &*pool : nullptr, cfg);
+
+    for (auto _ : state) {
+        auto measurements = ca(vecmem::get_data(input.event.cells), dd_data);
+        benchmark::DoNotOptimize(measurements.data());
+    }
+
+    host::clusterization_algorithm reference(input.mr);
+    const auto [max_distance, mismatched] = compare_measurements(
+        ca(vecmem::get_data(input.event.cells), dd_data),
+        reference(vecmem::get_data(input.event.cells), dd_data));
+    state.counters["cells"] = static_cast<double>(input.event.cells.size());
+    state.counters["max_distance_um"] = max_distance / unit<double>::um;
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(input.event.cells.size()));
+}
+BENCHMARK(BM_parallel_clusterization)
+    ->ArgsProduct({benchmark::CreateRange(16, 16384, 4), {1, 2, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
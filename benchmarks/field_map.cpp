@@ -0,0 +1,130 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/field_map.hpp"
+#include "common/rk_propagator.hpp"
+#include "common/telescope_navigator.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// A field map holding the chain's uniform field, written once
+const tutorial::field_map& uniform_field_map() {
+    static const tutorial::field_map map = [] {
+        const vector3 B = tutorial::benchmark_setup::instance().config().B;
+        const auto path = std::filesystem::temp_directory_path() /
+                          "tutorial_benchmark_field_map.bin";
+        tutorial::field_grid grid;
+        grid.n = {31u, 101u, 101u};
+        grid.min = {-100., -1000., -1000.};
+        grid.spacing = {20., 20., 20.};
+        tutorial::field_map::write(path.string(), grid,
+                                   [&](const point3&) { return B; });
+        tutorial::field_map result(path.string());
+        std::filesystem::remove(path);
+        return result;
+    }();
+    return map;
+}
+
+/// A field map looked up without the per-track cell cache
+struct uncached_field_map {
+    struct cache_type {};
+    const tutorial::field_map& map;
+    vector3 at(const point3& pos, cache_type&) const { return map.at(pos); }
+};
+
+/// The field types compared by the benchmark
+enum class field_kind { uniform, map_uncached, map_cached };
+
+}  // namespace
+
+/// Runge-Kutta propagation of particles through the telescope
+///
+/// The template argument selects the field: the constant field, or a field
+/// map of the same field, with and without the per-track cell cache. The
+/// largest distance of any plane crossing from the one in the constant
+/// field is reported as a counter.
+///
+template <field_kind KIND>
+static void BM_rk_propagation(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const tutorial::telescope_navigator navigator(setup.modules(),
+                                                  setup.config().B);
+
+    const tutorial::uniform_field uniform{setup.config().B};
+    const uncached_field_map uncached{uniform_field_map()};
+    const auto run = [&](const auto& field) {
+        const tutorial::rk_propagator propagator(navigator, field);
+        std::vector<tutorial::plane_crossing> crossings;
+        for (const auto& particle : input.event.particles) {
+            const scalar p = vector::norm(particle.momentum);
+            propagator.propagate(particle.vertex, particle.momentum / p,
+                                 particle.charge / p,
+                                 [&](const tutorial::plane_crossing& c) {
+                                     crossings.push_back(c);
+                                     return true;
+                                 });
+        }
+        return crossings;
+    };
+    const auto run_selected = [&]() {
+        if constexpr (KIND == field_kind::uniform) {
+            return run(uniform);
+        } else if constexpr (KIND == field_kind::map_uncached) {
+            return run(uncached);
+        } else {
+            return run(uniform_field_map());
+        }
+    };
+
+    for (auto _ : state) {
+        auto crossings = run_selected();
+        benchmark::DoNotOptimize(crossings.data());
+    }
+
+    const auto reference = run(uniform);
+    const auto crossings = run_selected();
+    double max_distance = 0.;
+    for (std::size_t i = 0; i < std::min(reference.size(), crossings.size());
+         ++i) {
+        max_distance = std::max(
+            max_distance, static_cast<double>(vector::norm(
+                              crossings[i].position - reference[i].position)));
+    }
+    state.counters["crossings"] = static_cast<double>(crossings.size());
+    state.counters["max_distance_um"] = max_distance / unit<double>::um;
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(input.event.particles.size()));
+}
+BENCHMARK_TEMPLATE(BM_rk_propagation, field_kind::uniform)
+    ->RangeMultiplier(8)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_rk_propagation, field_kind::map_uncached)
+    ->RangeMultiplier(8)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_rk_propagation, field_kind::map_cached)
+    ->RangeMultiplier(8)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMicrosecond);
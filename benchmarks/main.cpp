@@ -0,0 +1,29 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv)
+{
+    // Record which traccc version produced the results, so that the JSON
+    // output of different versions can be compared.
+    benchmark::AddCustomContext("traccc_version", TUTORIAL_TRACCC_VERSION);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    // Benchmarks whose results differ from their reference fail the run.
+    return traccc::tutorial::benchmarks_failed() ? 1 : 0;
+}
@@ -0,0 +1,163 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/measurement_index.hpp"
+
+// traccc include(s).
+#include "traccc/edm/measurement.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Measurements of a generated event, in random order
+measurement_collection_types::host shuffled_measurements(
+    std::size_t n_particles, vecmem::memory_resource& mr) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    const auto event = setup.generate(n_particles, mr);
+    auto measurements = setup.reconstruct(event, mr).measurements;
+    std::shuffle(measurements.begin(), measurements.end(),
+                 std::mt19937_64{42u});
+    return measurements;
+}
+
+}  // namespace
+
+/// Sorting the measurements for track finding with @c std::sort
+static void BM_measurement_std_sort(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto input = shuffled_measurements(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto measurements = input;
+        state.ResumeTiming();
+        std::sort(measurements.begin(), measurements.end(),
+                  measurement_sort_comp());
+        benchmark::DoNotOptimize(measurements.data());
+    }
+
+    state.counters["measurements"] = static_cast<double>(input.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(input.size()));
+}
+BENCHMARK(BM_measurement_std_sort)
+    ->RangeMultiplier(4)
+    ->Range(16, 16384)
+    ->Unit(benchmark::kMicrosecond);
+
+/// Sorting and indexing the measurements with @c measurement_index
+///
+/// The order is checked once against @c std::sort with @c
+/// measurement_sort_comp. Measurements that compare differently from those
+/// at the same position of the @c std::sort order, or that are not the
+/// input measurements, are "mismatched".
+///
+static void BM_measurement_radix_sort(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto input = shuffled_measurements(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto measurements = input;
+        state.ResumeTiming();
+        const tutorial::measurement_index index(measurements);
+        benchmark::DoNotOptimize(index.ranges().data());
+    }
+
+    // Compare with std::sort
+    auto radix_sorted = input;
+    const tutorial::measurement_index index(radix_sorted);
+    auto std_sorted = input;
+    measurement_sort_comp comp;
+    std::sort(std_sorted.begin(), std_sorted.end(), comp);
+    std::size_t mismatched = 0;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        mismatched += (comp(radix_sorted[i], std_sorted[i]) ||
+                       comp(std_sorted[i], radix_sorted[i]));
+    }
+    std::vector<std::size_t> radix_ids, input_ids;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        radix_ids.push_back(
+            static_cast<std::size_t>(radix_sorted[i].measurement_id));
+        input_ids.push_back(static_cast<std::size_t>(input[i].measurement_id));
+    }
+    std::sort(radix_ids.begin(), radix_ids.end());
+    std::sort(input_ids.begin(), input_ids.end());
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        mismatched += (radix_ids[i] != input_ids[i]);
+    }
+
+    state.counters["measurements"] = static_cast<double>(input.size());
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(input.size()));
+}
+BENCHMARK(BM_measurement_radix_sort)
+    ->RangeMultiplier(4)
+    ->Range(16, 16384)
+    ->Unit(benchmark::kMicrosecond);
+
+/// Finding the measurements of a surface, by binary search or from the table
+///
+/// The second argument selects the lookup: 0 for @c std::equal_range over
+/// the sorted measurements, 1 for the @c measurement_index table. Every
+/// iteration looks up the surface of every measurement, as track finding
+/// does for every track state.
+///
+static void BM_measurement_surface_lookup(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    auto measurements = shuffled_measurements(
+        static_cast<std::size_t>(state.range(0)), host_mr);
+    const tutorial::measurement_index index(measurements);
+    const bool use_table = (state.range(1) != 0);
+
+    const auto barcode_less = [](const measurement& a, const measurement& b) {
+        return a.surface_link < b.surface_link;
+    };
+    for (auto _ : state) {
+        std::size_t n_found = 0;
+        for (const measurement& meas : measurements) {
+            if (use_table) {
+                n_found += index[meas.surface_link].size();
+            } else {
+                const auto [first, last] =
+                    std::equal_range(measurements.begin(), measurements.end(),
+                                     meas, barcode_less);
+                n_found += static_cast<std::size_t>(last - first);
+            }
+        }
+        benchmark::DoNotOptimize(n_found);
+    }
+
+    state.counters["measurements"] = static_cast<double>(measurements.size());
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(measurements.size()));
+}
+BENCHMARK(BM_measurement_surface_lookup)
+    ->ArgsProduct({benchmark::CreateRange(16, 16384, 4), {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
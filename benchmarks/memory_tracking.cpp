@@ -0,0 +1,91 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/tracking_memory_resource.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+
+using namespace traccc;
+
+/// Full chain time per event, with and without the tracking memory resource
+///
+/// The first argument is the number of particles per event, the second one
+/// whether the chain allocates through a @c tracking_memory_resource. The
+/// peak of the event data allocations is reported. Events whose number of
+/// fitted tracks differs from the untracked chain are reported as
+/// "mismatched", as is an event whose measurements are not charged to the
+/// clusterization for as long as the event is alive.
+///
+static void BM_memory_tracking(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+    tutorial::tracking_memory_resource tracking(input.mr);
+    const bool tracked = (state.range(1) != 0);
+    vecmem::memory_resource& mr =
+        tracked ? static_cast<vecmem::memory_resource&>(tracking) : input.mr;
+
+    const tutorial::reconstruction_chain chain(
+        setup.config(), setup.detector(), setup.detector_description(),
+        setup.field(), mr);
+
+    std::size_t n_tracks = 0;
+    tutorial::stage_times times;
+    for (auto _ : state) {
+        const auto result = chain(input.event.cells, times);
+        n_tracks = result.track_states.size() +
+                   result.batched_track_states.size();
+        benchmark::DoNotOptimize(n_tracks);
+        tracking.next_event();
+    }
+
+    std::size_t mismatched =
+        (n_tracks != products.track_states.size() +
+                         products.batched_track_states.size());
+
+    // The measurements stay with the clusterization until the event is done
+    {
+        const auto clusterization =
+            static_cast<std::size_t>(tutorial::stage::clusterization);
+        tutorial::tracking_memory_resource check(input.mr);
+        const tutorial::reconstruction_chain check_chain(
+            setup.config(), setup.detector(), setup.detector_description(),
+            setup.field(), check);
+        std::size_t measurement_bytes = 0, live_bytes = 0;
+        {
+            const auto result = check_chain(input.event.cells, times);
+            measurement_bytes =
+                result.measurements.capacity() * sizeof(measurement);
+            live_bytes = check.statistics()[clusterization].live_bytes;
+            mismatched += (live_bytes < measurement_bytes);
+        }
+        mismatched += (check.statistics()[clusterization].live_bytes +
+                           measurement_bytes >
+                       live_bytes);
+    }
+
+    std::size_t peak = 0;
+    for (const auto& s : tracking.statistics()) {
+        peak = std::max(peak, s.peak_total_bytes);
+    }
+    state.counters["tracks"] = static_cast<double>(n_tracks);
+    state.counters["peak_bytes"] = static_cast<double>(peak);
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_memory_tracking)
+    ->ArgNames({"particles", "tracked"})
+    ->ArgsProduct({benchmark::CreateRange(16, 4096, 4), {0, 1}})
+    ->Unit(benchmark::kMillisecond);
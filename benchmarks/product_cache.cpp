@@ -0,0 +1,101 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+using namespace traccc;
+
+namespace {
+
+/// Whether two collections hold the same bytes
+template <typename collection_t>
+bool same_bytes(const collection_t& a, const collection_t& b) {
+    return a.size() == b.size() &&
+           (a.empty() || std::memcmp(a.data(), b.data(),
+                                     a.size() * sizeof(a[0])) == 0);
+}
+
+}  // namespace
+
+/// Time to get the products up to the track parameters, computed or cached
+///
+/// The first argument is the number of particles per event. With the second
+/// argument set, the chain uses a product cache that is filled before the
+/// timing, so every iteration loads the event from it. Products that differ
+/// from the computed ones are reported as "mismatched".
+///
+static void BM_product_cache(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+    const auto cells = vecmem::get_data(input.event.cells);
+    const bool cached = (state.range(1) != 0);
+
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "tutorial_product_cache";
+    std::filesystem::remove_all(directory);
+    tutorial::chain_config cfg = setup.config();
+    if (cached) {
+        cfg.product_cache = directory.string();
+    }
+    const tutorial::reconstruction_chain chain(
+        cfg, setup.detector(), setup.detector_description(), setup.field(),
+        input.mr);
+    tutorial::stage_times times;
+
+    // Fill the cache, if there is one
+    std::optional<tutorial::chain_result> products;
+    products.emplace(chain.make_result());
+    chain.clusterize(cells, *products, times);
+    chain.seed(*products, times);
+
+    for (auto _ : state) {
+        products.emplace(chain.make_result());
+        chain.clusterize(cells, *products, times);
+        chain.seed(*products, times);
+        benchmark::DoNotOptimize(products->params.data());
+    }
+
+    // The reference stops before the track finding, which sorts the
+    // measurements
+    const tutorial::reconstruction_chain reference_chain(
+        setup.config(), setup.detector(), setup.detector_description(),
+        setup.field(), input.mr);
+    tutorial::chain_result reference = reference_chain.make_result();
+    reference_chain.clusterize(cells, reference, times);
+    reference_chain.seed(reference, times);
+    std::size_t mismatched = 0;
+    mismatched += !same_bytes(products->measurements, reference.measurements);
+    mismatched += !same_bytes(products->spacepoints, reference.spacepoints);
+    mismatched += !same_bytes(products->seeds, reference.seeds);
+    mismatched += !same_bytes(products->params, reference.params);
+    mismatched += (products->from_cache != cached);
+    std::filesystem::remove_all(directory);
+
+    state.counters["cells"] = static_cast<double>(input.event.cells.size());
+    state.counters["seeds"] = static_cast<double>(products->seeds.size());
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(input.event.cells.size()));
+}
+BENCHMARK(BM_product_cache)
+    ->ArgNames({"particles", "cached"})
+    ->ArgsProduct({benchmark::CreateRange(16, 4096, 4), {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
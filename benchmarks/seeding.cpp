@@ -0,0 +1,157 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/grid_seeding.hpp"
+#include "common/thread_pool.hpp"
+#include "common/tracking_performance.hpp"
+
+// traccc include(s).
+#include "traccc/seeding/seeding_algorithm.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Particles with a seed whose three spacepoints all belong to them
+std::vector<bool> seeded_particles(
+    const tutorial::generated_event& event,
+    const spacepoint_collection_types::host& spacepoints,
+    const seed_collection_types::host& seeds) {
+
+    const tutorial::measurement_truth truth(event);
+    std::vector<bool> result(event.particles.size(), false);
+    for (const seed& s : seeds) {
+        const auto bottom = truth.particle_of(spacepoints[s.spB_link].meas);
+        if (bottom &&
+            bottom == truth.particle_of(spacepoints[s.spM_link].meas) &&
+            bottom == truth.particle_of(spacepoints[s.spT_link].meas)) {
+            result[*bottom] = true;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+/// Seeding time as a function of the number of spacepoints
+static void BM_seeding(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+
+    const auto& cfg = setup.config();
+    seeding_algorithm sa(cfg.finder, cfg.grid, cfg.filter, input.mr);
+
+    std::size_t n_seeds = 0;
+    for (auto _ : state) {
+        auto seeds = sa(products.spacepoints);
+        n_seeds = seeds.size();
+        benchmark::DoNotOptimize(seeds.data());
+    }
+
+    state.counters["spacepoints"] =
+        static_cast<double>(products.spacepoints.size());
+    state.counters["seeds"] = static_cast<double>(n_seeds);
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(products.spacepoints.size()));
+}
+BENCHMARK(BM_seeding)
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Unit(benchmark::kMillisecond);
+
+/// Grid seeding time as a function of the number of spacepoints
+///
+/// The arguments are the number of particles per event and the number of
+/// threads. The same instance, and so the same grid storage, is used for
+/// every iteration.
+///
+/// The seeds are checked against those of a single thread, which they must
+/// equal, and against those of @c seeding_algorithm on the same
+/// spacepoints: every particle that traccc's seeding finds a seed of (all
+/// three spacepoints from the particle) must be seeded by the grid seeding
+/// as well. Seeds that differ from the single-threaded ones and particles
+/// only seeded by traccc are "mismatched".
+///
+static void BM_grid_seeding(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+
+    std::optional<tutorial::thread_pool> pool;
+    if (state.range(1) > 1) {
+        pool.emplace(static_cast<std::size_t>(state.range(1)));
+    }
+    tutorial::grid_seeding_config cfg = setup.config().grid_seeding;
+    cfg.min_spacepoints_per_task = 256u;
+    const tutorial::grid_seeding sa(cfg, setup.modules(), setup.config().B,
+                                    input.mr, pool ? &*pool : nullptr);
+
+    std::size_t n_seeds = 0;
+    for (auto _ : state) {
+        auto seeds = sa(products.spacepoints);
+        n_seeds = seeds.size();
+        benchmark::DoNotOptimize(seeds.data());
+    }
+
+    // Compare with a single thread, and with traccc's seeding
+    const tutorial::grid_seeding single(cfg, setup.modules(),
+                                        setup.config().B, input.mr);
+    const auto seeds = sa(products.spacepoints);
+    const auto single_seeds = single(products.spacepoints);
+    std::size_t mismatched =
+        std::max(seeds.size(), single_seeds.size()) -
+        std::min(seeds.size(), single_seeds.size());
+    for (std::size_t i = 0; i < std::min(seeds.size(), single_seeds.size());
+         ++i) {
+        const seed& a = seeds[i];
+        const seed& b = single_seeds[i];
+        mismatched += (a.spB_link != b.spB_link || a.spM_link != b.spM_link ||
+                       a.spT_link != b.spT_link || a.weight != b.weight ||
+                       a.z_vertex != b.z_vertex);
+    }
+    const auto& chain_cfg = setup.config();
+    seeding_algorithm reference(chain_cfg.finder, chain_cfg.grid,
+                                chain_cfg.filter, input.mr);
+    const auto grid_seeded =
+        seeded_particles(input.event, products.spacepoints, seeds);
+    const auto traccc_seeded = seeded_particles(
+        input.event, products.spacepoints, reference(products.spacepoints));
+    std::size_t n_traccc_seeded = 0;
+    for (std::size_t i = 0; i < traccc_seeded.size(); ++i) {
+        n_traccc_seeded += traccc_seeded[i];
+        mismatched += (traccc_seeded[i] && !grid_seeded[i]);
+    }
+
+    state.counters["spacepoints"] =
+        static_cast<double>(products.spacepoints.size());
+    state.counters["seeds"] = static_cast<double>(n_seeds);
+    state.counters["traccc_seeded_particles"] =
+        static_cast<double>(n_traccc_seeded);
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(products.spacepoints.size()));
+}
+BENCHMARK(BM_grid_seeding)
+    ->ArgsProduct({benchmark::CreateRange(16, 4096, 4), {1, 2, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
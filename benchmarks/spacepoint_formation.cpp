@@ -0,0 +1,42 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+
+// traccc include(s).
+#include "traccc/seeding/silicon_pixel_spacepoint_formation_algorithm.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+using namespace traccc;
+
+/// Spacepoint formation time as a function of the number of measurements
+static void BM_spacepoint_formation(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto measurements_data = vecmem::get_data(input.event.measurements);
+
+    host::silicon_pixel_spacepoint_formation_algorithm sf(input.mr);
+
+    for (auto _ : state) {
+        auto spacepoints = sf(setup.detector(), measurements_data);
+        benchmark::DoNotOptimize(spacepoints.data());
+    }
+
+    state.counters["measurements"] =
+        static_cast<double>(input.event.measurements.size());
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(input.event.measurements.size()));
+}
+BENCHMARK(BM_spacepoint_formation)
+    ->RangeMultiplier(4)
+    ->Range(16, 16384)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,219 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/telescope_navigator.hpp"
+
+// detray include(s).
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/free_track_parameters.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Largest distance of a crossing, and difference of its path length, from
+/// the one found by detray's propagation
+///
+/// detray's Runge-Kutta stepper follows the helix to its error tolerance,
+/// but its navigator only stops on a surface to within its path tolerance
+/// (one micrometre by default).
+///
+constexpr double max_crossing_difference = 10. * unit<double>::um;
+
+/// Actor recording the sensitive modules reached by detray's propagation
+struct crossing_recorder : detray::actor {
+
+    struct state {
+        /// The sensitive modules, in module index order
+        const std::vector<tutorial::module_placement>* modules = nullptr;
+        /// The crossings, in the order of the propagation
+        std::vector<tutorial::plane_crossing> crossings;
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state& st, const propagator_state_t& propagation) const {
+
+        const auto& navigation = propagation._navigation;
+        if (!navigation.is_on_sensitive()) {
+            return;
+        }
+        const auto module = std::find_if(
+            st.modules->begin(), st.modules->end(),
+            [&](const tutorial::module_placement& m) {
+                return m.barcode == navigation.barcode();
+            });
+        const auto& stepping = propagation._stepping;
+        st.crossings.push_back(
+            {static_cast<unsigned int>(module - st.modules->begin()),
+             stepping().pos(), stepping().dir(),
+             static_cast<scalar>(stepping.path_length())});
+    }
+};
+
+/// Propagation of particles with detray's navigator and Runge-Kutta stepper
+///
+/// This is the generic approach: the navigator keeps a sorted list of
+/// candidate surfaces of the current volume, and intersects the track with
+/// them (and their masks) after every step. No material interactor is run,
+/// so the particles stay on their helices.
+///
+class detray_propagation {
+
+    public:
+    using detector_type = tutorial::reconstruction_chain::detector_type;
+    using field_type = tutorial::reconstruction_chain::field_type;
+    using stepper_type =
+        detray::rk_stepper<field_type::view_t, detector_type::algebra_type,
+                           detray::constrained_step<>>;
+    using navigator_type = detray::navigator<const detector_type>;
+    using actor_chain_type =
+        detray::actor_chain<detray::dtuple, crossing_recorder>;
+    using propagator_type =
+        detray::propagator<stepper_type, navigator_type, actor_chain_type>;
+
+    explicit detray_propagation(const tutorial::benchmark_setup& setup)
+        : m_setup(setup),
+          m_field(setup.field()),
+          m_propagator(setup.config().fitting.propagation) {}
+
+    /// Crossings of a particle with the modules
+    std::vector<tutorial::plane_crossing> operator()(
+        const tutorial::truth_particle& particle) const {
+
+        const detray::free_track_parameters<detector_type::algebra_type>
+            track(particle.vertex, 0.f, particle.momentum, particle.charge);
+        propagator_type::state propagation(track, m_field,
+                                                    m_setup.detector());
+        crossing_recorder::state recorder{&m_setup.modules(), {}};
+        m_propagator.propagate(propagation, detray::tie(recorder));
+        return std::move(recorder.crossings);
+    }
+
+    private:
+    const tutorial::benchmark_setup& m_setup;
+    field_type::view_t m_field;
+    propagator_type m_propagator;
+
+};  // class detray_propagation
+
+/// Crossings of a particle with the modules, with the telescope navigator
+std::vector<tutorial::plane_crossing> telescope_crossings(
+    const tutorial::telescope_navigator& navigator,
+    const tutorial::truth_particle& particle) {
+
+    const scalar p = vector::norm(particle.momentum);
+    std::vector<tutorial::plane_crossing> result;
+    navigator.propagate(particle.vertex, particle.momentum / p,
+                        particle.charge / p,
+                        [&](const tutorial::plane_crossing& crossing) {
+                            result.push_back(crossing);
+                            return true;
+                        });
+    return result;
+}
+
+}  // namespace
+
+/// Propagation of particles through the telescope with detray's navigator
+static void BM_detray_navigation(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const detray_propagation propagation(setup);
+
+    for (auto _ : state) {
+        for (const auto& particle : input.event.particles) {
+            auto crossings = propagation(particle);
+            benchmark::DoNotOptimize(crossings.data());
+        }
+    }
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(input.event.particles.size()));
+}
+BENCHMARK(BM_detray_navigation)
+    ->RangeMultiplier(8)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMicrosecond);
+
+/// Propagation of particles through the telescope with the telescope
+/// navigator
+///
+/// The crossings are compared with those of detray's propagation on the same
+/// particles. The largest distance and path length difference of any
+/// crossing are reported as counters, and crossings found by only one of
+/// the two, on different modules, or further apart than @c
+/// max_crossing_difference are "mismatched".
+///
+static void BM_telescope_navigation(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const tutorial::telescope_navigator navigator(setup.modules(),
+                                                  setup.config().B);
+
+    for (auto _ : state) {
+        for (const auto& particle : input.event.particles) {
+            auto crossings = telescope_crossings(navigator, particle);
+            benchmark::DoNotOptimize(crossings.data());
+        }
+    }
+
+    // Compare with detray's propagation
+    const detray_propagation propagation(setup);
+    double max_distance = 0., max_path_difference = 0.;
+    std::size_t n_mismatched = 0;
+    for (const auto& particle : input.event.particles) {
+        const auto fast = telescope_crossings(navigator, particle);
+        const auto generic = propagation(particle);
+        if (fast.size() != generic.size()) {
+            n_mismatched += std::max(fast.size(), generic.size()) -
+                            std::min(fast.size(), generic.size());
+        }
+        for (std::size_t i = 0; i < std::min(fast.size(), generic.size());
+             ++i) {
+            if (fast[i].module != generic[i].module) {
+                ++n_mismatched;
+                continue;
+            }
+            const double distance = static_cast<double>(
+                vector::norm(fast[i].position - generic[i].position));
+            const double path_difference = std::abs(
+                static_cast<double>(fast[i].path - generic[i].path));
+            max_distance = std::max(max_distance, distance);
+            max_path_difference =
+                std::max(max_path_difference, path_difference);
+            n_mismatched += (distance > max_crossing_difference ||
+                             path_difference > max_crossing_difference);
+        }
+    }
+    state.counters["max_distance_um"] = max_distance / unit<double>::um;
+    state.counters["max_path_diff_um"] = max_path_difference / unit<double>::um;
+    tutorial::check_mismatches(state, n_mismatched);
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(input.event.particles.size()));
+}
+BENCHMARK(BM_telescope_navigation)
+    ->RangeMultiplier(8)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMicrosecond);
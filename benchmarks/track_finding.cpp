@@ -0,0 +1,268 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/ambiguity_resolution.hpp"
+#include "common/parallel_track_finding.hpp"
+#include "common/thread_pool.hpp"
+
+// traccc include(s).
+#include "traccc/finding/combinatorial_kalman_filter_algorithm.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Number of particles of the event that @c BM_track_finding takes its
+/// seeds from
+constexpr std::size_t n_seeding_particles = 4096u;
+
+}  // namespace
+
+/// Combinatorial Kalman filter time as a function of the number of seeds
+///
+/// The argument is the number of seeds. They are the first seeds of one
+/// event with @c n_seeding_particles particles, so the measurements that
+/// the tracks are searched in stay the same for every number of seeds.
+///
+static void BM_track_finding(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(n_seeding_particles);
+    // The chain leaves the measurements sorted, as track finding expects.
+    const auto& products = input.products();
+    const auto n_seeds = std::min(static_cast<std::size_t>(state.range(0)),
+                                  products.params.size());
+    const bound_track_parameters_collection_types::host params(
+        products.params.begin(),
+        products.params.begin() + static_cast<std::ptrdiff_t>(n_seeds),
+        &input.mr);
+    const auto measurements_data = vecmem::get_data(products.measurements);
+    const auto params_data = vecmem::get_data(params);
+
+    host::combinatorial_kalman_filter_algorithm finding(
+        setup.config().finding);
+
+    std::size_t n_tracks = 0;
+    for (auto _ : state) {
+        auto track_candidates = finding(setup.detector(), setup.field(),
+                                        measurements_data, params_data);
+        n_tracks = track_candidates.size();
+        benchmark::DoNotOptimize(n_tracks);
+    }
+
+    state.counters["seeds"] = static_cast<double>(n_seeds);
+    state.counters["tracks"] = static_cast<double>(n_tracks);
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_seeds));
+}
+BENCHMARK(BM_track_finding)
+    ->ArgName("seeds")
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Unit(benchmark::kMillisecond);
+
+namespace {
+
+/// The measurements of every candidate, in a canonical order
+std::vector<std::vector<std::tuple<std::uint64_t, scalar, scalar>>>
+canonical_tracks(const track_candidate_container_types::host& candidates) {
+
+    std::vector<std::vector<std::tuple<std::uint64_t, scalar, scalar>>>
+        result(candidates.size());
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        for (const measurement& meas : candidates.at(i).items) {
+            result[i].emplace_back(meas.surface_link.value(), meas.local[0],
+                                   meas.local[1]);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+}  // namespace
+
+/// Seed-parallel combinatorial Kalman filter time
+///
+/// The arguments are the number of particles per event and the number of
+/// threads. Candidates that differ from those of a single call to traccc's
+/// CKF are reported as the "mismatched" counter.
+///
+static void BM_parallel_track_finding(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+    const auto measurements_data = vecmem::get_data(products.measurements);
+    const auto params_data = vecmem::get_data(products.params);
+
+    std::optional<tutorial::thread_pool> pool;
+    if (state.range(1) > 1) {
+        pool.emplace(static_cast<std::size_t>(state.range(1)));
+    }
+    const tutorial::parallel_track_finding finding(
+        setup.config().finding, input.mr, pool ? &*pool : nullptr);
+
+    std::size_t n_tracks = 0;
+    for (auto _ : state) {
+        auto track_candidates = finding(setup.detector(), setup.field(),
+                                        measurements_data, params_data);
+        n_tracks = track_candidates.size();
+        benchmark::DoNotOptimize(n_tracks);
+    }
+
+    host::combinatorial_kalman_filter_algorithm serial(
+        setup.config().finding);
+    const auto parallel_tracks = canonical_tracks(finding(
+        setup.detector(), setup.field(), measurements_data, params_data));
+    const auto serial_tracks = canonical_tracks(serial(
+        setup.detector(), setup.field(), measurements_data, params_data));
+    std::size_t mismatched = std::max(parallel_tracks.size(),
+                                      serial_tracks.size()) -
+                             std::min(parallel_tracks.size(),
+                                      serial_tracks.size());
+    for (std::size_t i = 0;
+         i < std::min(parallel_tracks.size(), serial_tracks.size()); ++i) {
+        mismatched += (parallel_tracks[i] != serial_tracks[i]) ? 1u : 0u;
+    }
+
+    state.counters["seeds"] = static_cast<double>(products.params.size());
+    state.counters["tracks"] = static_cast<double>(n_tracks);
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(products.params.size()));
+}
+BENCHMARK(BM_parallel_track_finding)
+    ->ArgsProduct({benchmark::CreateRange(16, 4096, 4), {1, 2, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+namespace {
+
+/// Greedy ambiguity resolution that recounts the shared measurements of all
+/// remaining candidates before every removal
+std::vector<std::size_t> rescanning_ambiguity_resolution(
+    const track_candidate_container_types::host& candidates,
+    const tutorial::ambiguity_resolution_config& cfg) {
+
+    const std::size_t n_tracks = candidates.size();
+    std::vector<bool> removed(n_tracks, false);
+    unsigned int n_ids = 0u;
+    for (std::size_t t = 0; t < n_tracks; ++t) {
+        removed[t] = candidates.at(t).items.size() < cfg.min_measurements;
+        for (const measurement& meas : candidates.at(t).items) {
+            n_ids = std::max(n_ids, meas.measurement_id + 1u);
+        }
+    }
+    while (true) {
+        std::vector<unsigned int> n_users(n_ids, 0u);
+        for (std::size_t t = 0; t < n_tracks; ++t) {
+            if (!removed[t]) {
+                for (const measurement& meas : candidates.at(t).items) {
+                    ++n_users[meas.measurement_id];
+                }
+            }
+        }
+        // Same order as the algorithm: most shared, shortest, last
+        std::optional<std::size_t> worst;
+        std::tuple<unsigned int, std::size_t> worst_key{0u, 0u};
+        for (std::size_t t = 0; t < n_tracks; ++t) {
+            if (removed[t]) {
+                continue;
+            }
+            unsigned int n_shared = 0u;
+            for (const measurement& meas : candidates.at(t).items) {
+                n_shared += (n_users[meas.measurement_id] > 1u);
+            }
+            const std::size_t n = candidates.at(t).items.size();
+            if (!worst || n_shared > std::get<0>(worst_key) ||
+                (n_shared == std::get<0>(worst_key) &&
+                 n <= std::get<1>(worst_key))) {
+                worst = t;
+                worst_key = {n_shared, n};
+            }
+        }
+        if (!worst || std::get<0>(worst_key) <= cfg.max_shared_measurements) {
+            break;
+        }
+        removed[*worst] = true;
+    }
+
+    std::vector<std::size_t> result;
+    for (std::size_t t = 0; t < n_tracks; ++t) {
+        if (!removed[t]) {
+            result.push_back(t);
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+/// Greedy ambiguity resolution time as a function of the number of particles
+///
+/// Resolves the candidates of traccc's CKF. Besides the number of candidates
+/// before and after, the time of a resolution that recounts all shared
+/// measurements before every removal is reported as "rescan_ms", and
+/// candidates that it keeps differently as "mismatched".
+///
+static void BM_ambiguity_resolution(benchmark::State& state) {
+
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+
+    const tutorial::ambiguity_resolution_config cfg;
+    const tutorial::greedy_ambiguity_resolution resolution(cfg, input.mr);
+
+    std::size_t n_kept = 0;
+    for (auto _ : state) {
+        auto kept = resolution(products.track_candidates);
+        n_kept = kept.size();
+        benchmark::DoNotOptimize(n_kept);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<std::size_t> rescanned =
+        rescanning_ambiguity_resolution(products.track_candidates, cfg);
+    const std::chrono::duration<double, std::milli> rescan_time =
+        std::chrono::steady_clock::now() - start;
+    const std::vector<std::size_t> selected =
+        resolution.select(products.track_candidates);
+    std::size_t mismatched =
+        std::max(selected.size(), rescanned.size()) -
+        std::min(selected.size(), rescanned.size());
+    for (std::size_t i = 0; i < std::min(selected.size(), rescanned.size());
+         ++i) {
+        mismatched += (selected[i] != rescanned[i]) ? 1u : 0u;
+    }
+
+    state.counters["tracks"] =
+        static_cast<double>(products.track_candidates.size());
+    state.counters["kept"] = static_cast<double>(n_kept);
+    state.counters["rescan_ms"] = rescan_time.count();
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(products.track_candidates.size()));
+}
+BENCHMARK(BM_ambiguity_resolution)
+    ->ArgName("particles")
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,250 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/adaptive_fitting.hpp"
+#include "common/host_device_fitting.hpp"
+#include "common/thread_pool.hpp"
+
+// traccc include(s).
+#include "traccc/device/container_d2h_copy_alg.hpp"
+#include "traccc/device/container_h2d_copy_alg.hpp"
+#include "traccc/fitting/kalman_filter/kalman_fitter.hpp"
+#include "traccc/fitting/kalman_fitting_algorithm.hpp"
+
+// detray include(s).
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// VecMem include(s).
+#include <vecmem/utils/copy.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+
+using namespace traccc;
+
+namespace {
+
+/// Largest difference of a fitted parameter between the adaptive and the
+/// fixed-iteration fit, in units of the latter's uncertainty
+///
+/// The iterations of the two are seeded with differently inflated
+/// covariances, so converged fits agree well within their uncertainty, but
+/// not exactly.
+///
+constexpr double max_adaptive_pull_difference = 1.;
+
+/// Largest chi2/NDF difference between the adaptive and the fixed-iteration
+/// fit
+constexpr double max_adaptive_chi2_ndf_difference = 1.;
+
+}  // namespace
+
+/// Kalman fitting time as a function of the number of tracks and iterations
+///
+/// The first argument is the number of particles per event, the second one
+/// is @c fitting_config::n_iterations.
+///
+static void BM_track_fitting(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+    const auto track_candidates_data =
+        traccc::get_data(products.track_candidates);
+
+    fitting_config fit_cfg = setup.config().fitting;
+    fit_cfg.n_iterations = static_cast<unsigned int>(state.range(1));
+    host::kalman_fitting_algorithm fitting(fit_cfg, input.mr);
+
+    for (auto _ : state) {
+        auto track_states =
+            fitting(setup.detector(), setup.field(), track_candidates_data);
+        benchmark::DoNotOptimize(track_states.size());
+    }
+
+    state.counters["tracks"] =
+        static_cast<double>(products.track_candidates.size());
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(products.track_candidates.size()));
+}
+BENCHMARK(BM_track_fitting)
+    ->ArgNames({"particles", "n_iterations"})
+    ->ArgsProduct({benchmark::CreateRange(16, 4096, 4), {1, 2, 3}})
+    ->Unit(benchmark::kMillisecond);
+
+/// Kalman fitting time with iterations until convergence
+///
+/// The first argument is the number of particles per event, the second one
+/// is the largest number of iterations, to compare with @c BM_track_fitting
+/// at the same @c n_iterations. The mean number of fits per track is
+/// reported as the "mean_iterations" counter.
+///
+/// The tracks are compared with those of @c host::kalman_fitting_algorithm
+/// with @c n_iterations set to the largest number of iterations. Tracks
+/// whose NDF differs, or whose chi2/NDF or parameters differ by more than
+/// @c max_adaptive_chi2_ndf_difference or @c max_adaptive_pull_difference,
+/// are "mismatched".
+///
+static void BM_adaptive_track_fitting(benchmark::State& state) {
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+
+    tutorial::adaptive_fitting_config adaptive_cfg;
+    adaptive_cfg.max_iterations = static_cast<unsigned int>(state.range(1));
+    const tutorial::adaptive_kalman_fitting fitting(setup.config().fitting,
+                                                    adaptive_cfg, input.mr);
+
+    tutorial::iteration_histogram iterations;
+    for (auto _ : state) {
+        iterations = {};
+        auto track_states =
+            fitting(setup.detector(), setup.field(),
+                    products.track_candidates, &iterations);
+        benchmark::DoNotOptimize(track_states.size());
+    }
+
+    // Compare with the fixed number of iterations
+    fitting_config fixed_cfg = setup.config().fitting;
+    fixed_cfg.n_iterations = adaptive_cfg.max_iterations;
+    host::kalman_fitting_algorithm fixed_fitting(fixed_cfg, input.mr);
+    const auto adaptive_states = fitting(setup.detector(), setup.field(),
+                                         products.track_candidates);
+    const auto fixed_states =
+        fixed_fitting(setup.detector(), setup.field(),
+                      traccc::get_data(products.track_candidates));
+    std::size_t mismatched = 0;
+    for (std::size_t i = 0; i < fixed_states.size(); ++i) {
+        const auto& a = adaptive_states.at(i).header;
+        const auto& b = fixed_states.at(i).header;
+        if (a.ndf != b.ndf) {
+            ++mismatched;
+            continue;
+        }
+        if (!(b.ndf > 0.f)) {
+            continue;
+        }
+        bool mismatch = std::abs(static_cast<double>(a.chi2 - b.chi2)) /
+                            static_cast<double>(b.ndf) >
+                        max_adaptive_chi2_ndf_difference;
+        for (unsigned int k = 0; k < e_bound_size; ++k) {
+            const auto& va = a.fit_params.vector();
+            const auto& vb = b.fit_params.vector();
+            double change = static_cast<double>(getter::element(va, k, 0u)) -
+                            static_cast<double>(getter::element(vb, k, 0u));
+            if (k == e_bound_phi) {
+                change = std::remainder(change, 2. * constant<double>::pi);
+            }
+            const double variance = static_cast<double>(
+                getter::element(b.fit_params.covariance(), k, k));
+            mismatch |= !(change * change <=
+                          max_adaptive_pull_difference *
+                              max_adaptive_pull_difference * variance);
+        }
+        mismatched += mismatch;
+    }
+
+    state.counters["tracks"] =
+        static_cast<double>(products.track_candidates.size());
+    state.counters["mean_iterations"] = iterations.mean();
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(products.track_candidates.size()));
+}
+BENCHMARK(BM_adaptive_track_fitting)
+    ->ArgNames({"particles", "max_iterations"})
+    ->ArgsProduct({benchmark::CreateRange(16, 4096, 4), {1, 2, 3}})
+    ->Unit(benchmark::kMillisecond);
+
+/// Time of the device fitting kernels executed on CPU threads
+///
+/// The arguments are the number of particles per event and the number of
+/// threads. The candidates are copied into "device" buffers and the fitted
+/// states back, as in the CUDA chain, and the copies are part of the timing.
+/// Tracks whose NDF or chi2 differ from those of @c
+/// host::kalman_fitting_algorithm are reported as the "mismatched" counter.
+///
+static void BM_host_device_fitting(benchmark::State& state) {
+
+    using stepper_type =
+        detray::rk_stepper<detray::bfield::const_field_t::view_t,
+                           traccc::default_detector::host::algebra_type,
+                           detray::constrained_step<>>;
+    using navigator_type =
+        detray::navigator<const traccc::default_detector::device>;
+    using fitting_type = tutorial::host_device_fitting_algorithm<
+        traccc::kalman_fitter<stepper_type, navigator_type>>;
+
+    const auto& setup = tutorial::benchmark_setup::instance();
+    tutorial::benchmark_event input(state);
+    const auto& products = input.products();
+
+    std::optional<tutorial::thread_pool> pool;
+    if (state.range(1) > 1) {
+        pool.emplace(static_cast<std::size_t>(state.range(1)));
+    }
+    traccc::memory_resource mr{input.mr, &input.mr};
+    vecmem::copy copy;
+    traccc::device::container_h2d_copy_alg<track_candidate_container_types>
+        candidates_h2d{mr, copy};
+    traccc::device::container_d2h_copy_alg<track_state_container_types>
+        states_d2h{mr, copy};
+    const fitting_type fitting(setup.config().fitting, mr, copy,
+                               pool ? &*pool : nullptr);
+    const auto det_view = detray::get_data(setup.detector());
+
+    const auto fit = [&]() {
+        const track_candidate_container_types::buffer candidates =
+            candidates_h2d(traccc::get_data(products.track_candidates));
+        return states_d2h(fitting(det_view, setup.field(), candidates));
+    };
+    for (auto _ : state) {
+        auto track_states = fit();
+        benchmark::DoNotOptimize(track_states.size());
+    }
+
+    host::kalman_fitting_algorithm host_fitting(setup.config().fitting,
+                                                input.mr);
+    const auto device_states = fit();
+    const auto host_states =
+        host_fitting(setup.detector(), setup.field(),
+                     traccc::get_data(products.track_candidates));
+    std::size_t mismatched = 0;
+    for (std::size_t i = 0; i < host_states.size(); ++i) {
+        const auto& a = host_states.at(i).header;
+        const auto& b = device_states.at(i).header;
+        mismatched += (a.ndf != b.ndf ||
+                       std::abs(a.chi2 - b.chi2) >
+                           1e-3 * std::max<double>(std::abs(a.chi2), 1.))
+                          ? 1u
+                          : 0u;
+    }
+
+    state.counters["tracks"] =
+        static_cast<double>(products.track_candidates.size());
+    tutorial::check_mismatches(state, mismatched);
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(products.track_candidates.size()));
+}
+BENCHMARK(BM_host_device_fitting)
+    ->ArgNames({"particles", "threads"})
+    ->ArgsProduct({benchmark::CreateRange(16, 4096, 4), {1, 2, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,116 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "benchmark_setup.hpp"
+#include "common/track_state_file.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+using namespace traccc;
+
+namespace {
+
+/// Number of events written per benchmark iteration
+constexpr std::size_t n_written_events = 16u;
+
+/// Columns of the fitted tracks of a generated event
+tutorial::track_state_table fitted_tracks(std::size_t n_particles,
+                                          vecmem::memory_resource& mr) {
+    const auto& setup = tutorial::benchmark_setup::instance();
+    const auto event = setup.generate(n_particles, mr);
+    const auto products = setup.reconstruct(event, mr);
+    return setup.config().use_batched_fitter
+               ? tutorial::make_track_state_table(
+                     0u, products.batched_track_states)
+               : tutorial::make_track_state_table(0u, products.track_states);
+}
+
+}  // namespace
+
+/// Track state file writing time as a function of the number of particles
+///
+/// Every iteration writes the same event @c n_written_events times and
+/// closes the file, so the time includes waiting for the background thread.
+/// The second argument selects the compression. Besides the file size per
+/// track, columns that differ after reading the file back are reported as
+/// "mismatched".
+///
+static void BM_track_state_writing(benchmark::State& state) {
+
+    vecmem::host_memory_resource host_mr;
+    const tutorial::track_state_table table =
+        fitted_tracks(static_cast<std::size_t>(state.range(0)), host_mr);
+    const auto compression =
+        static_cast<tutorial::track_file_compression>(state.range(1));
+    const std::string path = (std::filesystem::temp_directory_path() /
+                              "tutorial_track_states.bin")
+                                 .string();
+
+    std::uint64_t bytes = 0;
+    for (auto _ : state) {
+        tutorial::track_state_file_writer writer(path, compression);
+        for (std::size_t i = 0; i < n_written_events; ++i) {
+            writer.write(table);
+        }
+        writer.close();
+        bytes = writer.bytes_written();
+    }
+
+    std::size_t mismatched = 0;
+    {
+        const tutorial::track_state_file_reader reader(path);
+        // Bitwise, so that NaNs of failed fits compare equal
+        const auto equal = [](const auto& read, const auto& written) {
+            return read.size() == written.size() &&
+                   (read.empty() || std::memcmp(read.data(), written.data(),
+                                                read.size_bytes()) == 0);
+        };
+        for (std::size_t i = 0; i < reader.size(); ++i) {
+            const auto event = reader.event(i);
+            mismatched += !equal(event.chi2(), table.chi2);
+            mismatched += !equal(event.ndf(), table.ndf);
+            mismatched += !equal(event.n_states_per_track(), table.n_states);
+            mismatched += !equal(event.surface(), table.surface);
+            mismatched += !equal(event.params(), table.params);
+            mismatched += !equal(event.covariance(), table.covariance);
+            mismatched += !equal(event.state_surface(), table.state_surface);
+            mismatched += !equal(event.state_local(), table.state_local);
+            mismatched += !equal(event.state_residual(), table.state_residual);
+            mismatched += !equal(event.state_chi2(), table.state_chi2);
+            mismatched += !equal(event.state_hole(), table.state_hole);
+        }
+    }
+    std::remove(path.c_str());
+
+    const auto n_tracks = table.n_tracks() * n_written_events;
+    state.counters["tracks"] = static_cast<double>(table.n_tracks());
+    state.counters["bytes_per_track"] =
+        static_cast<double>(bytes) /
+        static_cast<double>(std::max<std::size_t>(n_tracks, 1u));
+    tutorial::check_mismatches(state, mismatched);
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_tracks));
+}
+BENCHMARK(BM_track_state_writing)
+    ->ArgNames({"particles", "compression"})
+    ->ArgsProduct({benchmark::CreateRange(16, 4096, 4), {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+#
+# TRACCC tutorial for beginners
+#
+# (c) 2025 CERN for the benefit of the ACTS project
+#
+# Mozilla Public License Version 2.0
+
+"""Compare the throughput and physics performance of two builds.
+
+Runs full_chain from a reference build (e.g. TUTORIAL_PRECISION=double) and
+from one or more other builds (e.g. float, mixed) on the same generated
+events, and prints the speedup against the change in efficiency, chi2/NDF
+and momentum bias and resolution.
+
+Every build fits with the same fitter (--fitter), as the builds would
+otherwise pick different ones by default. With the default, the batched
+fitter, the tracks are fitted in double precision in every build, so only
+the precision of the other stages differs; with --fitter=traccc traccc's
+Kalman fitter runs in the precision of each build.
+
+    scripts/compare_precision.py build_double build_float build_mixed \\
+        --events=200 --particles=500
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+# Quantities parsed from the full_chain summary
+PATTERNS = {
+    "precision": r"^Precision: (\S+)",
+    "events/s": r"^Processed \d+ events in \S+ s \((\S+) events/s\)",
+    "tracks/event": r"^Fitted tracks per event: (\S+)",
+    "efficiency": r"^Track finding efficiency: (\S+)",
+    "chi2/NDF": r"^Mean chi2/NDF: (\S+)",
+    "p bias": r"^Momentum bias: (\S+)",
+    "p resolution": r"^Momentum resolution: (\S+)",
+}
+
+
+def run(build_dir, args):
+    """Run full_chain of one build and parse its summary."""
+    executable = Path(build_dir) / "full_chain"
+    command = [str(executable)] + args
+    output = subprocess.run(command, check=True, capture_output=True,
+                            text=True).stdout
+    result = {}
+    for name, pattern in PATTERNS.items():
+        match = re.search(pattern, output, re.MULTILINE)
+        if match is None:
+            sys.exit(f"Could not find '{name}' in the output of {command}")
+        value = match.group(1)
+        result[name] = value if name == "precision" else float(value)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("reference", help="Build directory of the reference")
+    parser.add_argument("builds", nargs="+",
+                        help="Build directories to compare with it")
+    parser.add_argument("--events", type=int, default=100)
+    parser.add_argument("--particles", type=int, default=100)
+    parser.add_argument("--threads", type=int, default=1)
+    parser.add_argument("--seed", type=int, default=42)
+    parser.add_argument("--fitter", default="batched",
+                        choices=["traccc", "batched", "smoother"],
+                        help="Fitter used by every build")
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="Runs per build; the fastest one is used")
+    args = parser.parse_args()
+
+    chain_args = [f"--events={args.events}",
+                  f"--particles={args.particles}",
+                  f"--threads={args.threads}", f"--seed={args.seed}",
+                  f"--fitter={args.fitter}"]
+
+    def best_of(build_dir):
+        runs = [run(build_dir, chain_args) for _ in range(args.repeat)]
+        return max(runs, key=lambda r: r["events/s"])
+
+    reference = best_of(args.reference)
+    results = [(args.reference, reference)] + \
+        [(build, best_of(build)) for build in args.builds]
+
+    header = f"{'build':<24}{'precision':>10}{'events/s':>12}" \
+             f"{'speedup':>9}{'eff.':>9}{'d(eff.)':>10}{'chi2/NDF':>10}" \
+             f"{'d(chi2)':>9}{'dp/p bias':>11}{'d(bias)':>10}" \
+             f"{'dp/p res.':>11}{'d(res.)':>10}"
+    print(header)
+    print("-" * len(header))
+    for build, r in results:
+        print(f"{Path(build).name:<24}{r['precision']:>10}"
+              f"{r['events/s']:>12.1f}"
+              f"{r['events/s'] / reference['events/s']:>9.2f}"
+              f"{r['efficiency']:>9.4f}"
+              f"{r['efficiency'] - reference['efficiency']:>+10.4f}"
+              f"{r['chi2/NDF']:>10.3f}"
+              f"{r['chi2/NDF'] - reference['chi2/NDF']:>+9.3f}"
+              f"{r['p bias']:>11.5f}"
+              f"{r['p bias'] - reference['p bias']:>+10.5f}"
+              f"{r['p resolution']:>11.5f}"
+              f"{r['p resolution'] - reference['p resolution']:>+10.5f}")
+
+
+if __name__ == "__main__":
+    main()
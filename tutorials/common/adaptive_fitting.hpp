@@ -0,0 +1,313 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/instrumentation.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/kalman_fitting_algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of @c adaptive_kalman_fitting
+struct adaptive_fitting_config {
+    /// Largest number of fits of a track
+    unsigned int max_iterations = 5u;
+    /// Largest change of any parameter from the track finding seed to the
+    /// first fit, in units of the seed's uncertainty, for a track that is
+    /// not refitted
+    scalar seed_tolerance = 1.f;
+    /// Largest chi2/NDF of the first fit for a track that is not refitted
+    scalar max_chi2_ndf = 5.f;
+    /// Largest change of any fitted parameter between two iterations, in
+    /// units of its fitted uncertainty, for a converged track
+    scalar parameter_tolerance = 0.01f;
+    /// Largest relative change of the chi2 between two iterations for a
+    /// converged track
+    scalar chi2_tolerance = 0.001f;
+    /// Factor on the covariance of an iteration's result before it seeds the
+    /// next iteration, so that the seed does not outweigh the measurements
+    scalar covariance_inflation = 100.f;
+};
+
+/// Number of tracks per number of fit iterations used
+struct iteration_histogram {
+
+    /// Tracks with @c i iterations are counted in @c counts[i]
+    std::vector<std::size_t> counts;
+
+    /// Count a track fitted @c n_iterations times
+    void add(unsigned int n_iterations) {
+        if (n_iterations >= counts.size()) {
+            counts.resize(n_iterations + 1u);
+        }
+        ++counts[n_iterations];
+    }
+
+    /// Number of counted tracks
+    std::size_t n_tracks() const {
+        std::size_t result = 0;
+        for (const std::size_t c : counts) {
+            result += c;
+        }
+        return result;
+    }
+
+    /// Mean number of iterations per track
+    double mean() const {
+        double sum = 0.;
+        for (std::size_t i = 0; i < counts.size(); ++i) {
+            sum += static_cast<double>(i * counts[i]);
+        }
+        const std::size_t n = n_tracks();
+        return n > 0u ? sum / static_cast<double>(n) : 0.;
+    }
+
+    /// Accumulate another (e.g. per-event) histogram
+    iteration_histogram& operator+=(const iteration_histogram& other) {
+        if (other.counts.size() > counts.size()) {
+            counts.resize(other.counts.size());
+        }
+        for (std::size_t i = 0; i < other.counts.size(); ++i) {
+            counts[i] += other.counts[i];
+        }
+        return *this;
+    }
+
+    /// Print the histogram
+    void print(std::ostream& out) const {
+        const double n = static_cast<double>(std::max<std::size_t>(
+            n_tracks(), 1u));
+        out << std::setw(12) << "iterations" << std::setw(10) << "tracks"
+            << std::setw(10) << "share" << std::endl;
+        for (std::size_t i = 1; i < counts.size(); ++i) {
+            out << std::setw(12) << i << std::setw(10) << counts[i]
+                << std::setw(9) << std::fixed << std::setprecision(1)
+                << 100. * static_cast<double>(counts[i]) / n << "%"
+                << std::endl;
+        }
+        out << "Mean iterations per track: " << std::setprecision(3)
+            << mean() << std::defaultfloat << std::setprecision(6)
+            << std::endl;
+    }
+
+};  // struct iteration_histogram
+
+/// Number of measurements of all track candidates, i.e. the measurement
+/// updates of one forward filter pass over them
+inline std::size_t n_candidate_measurements(
+    const track_candidate_container_types::host& candidates) {
+
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        result += candidates.at(i).items.size();
+    }
+    return result;
+}
+
+/// Iterative Kalman fitting that stops refitting converged tracks
+///
+/// @c fitting_config::n_iterations refits every track a fixed number of
+/// times, seeding each iteration with the result of the previous one. This
+/// algorithm fits all tracks once with traccc's Kalman fitter, and then
+/// refits only the tracks that have not converged, seeded with their last
+/// result (with an inflated covariance).
+///
+/// After the first fit, a track is kept when no parameter moved by more
+/// than @c seed_tolerance times the uncertainty of the track finding seed,
+/// and its chi2/NDF is at most @c max_chi2_ndf: the fit did not move far
+/// enough from the seed for the linearisation around it to matter. From the
+/// second fit on, a track has converged when no fitted parameter moved by
+/// more than @c parameter_tolerance times its fitted uncertainty from the
+/// previous fit, and its chi2 changed by less than @c chi2_tolerance. Tracks
+/// that fail to fit are not refitted.
+///
+class adaptive_kalman_fitting {
+
+    public:
+    /// Fit result of one track
+    using fit_result_type = fitting_result<traccc::default_algebra>;
+
+    /// Construct the algorithm
+    ///
+    /// @param fit_cfg Configuration of the Kalman fitter; its @c
+    ///                n_iterations is replaced by one
+    /// @param cfg     The convergence configuration
+    /// @param mr      Memory resource for the output track states
+    ///
+    adaptive_kalman_fitting(const fitting_config& fit_cfg,
+                            const adaptive_fitting_config& cfg,
+                            vecmem::memory_resource& mr)
+        : m_cfg(cfg), m_mr(mr), m_fitting(single_iteration(fit_cfg), mr) {}
+
+    /// Fit the track candidates of an event
+    ///
+    /// @param det        The detector
+    /// @param field      The magnetic field
+    /// @param candidates The track candidates
+    /// @param iterations If not null, the iterations used by every track are
+    ///                   added to it
+    /// @return The track states, in the order of @c candidates
+    ///
+    template <typename detector_t, typename field_t>
+    track_state_container_types::host operator()(
+        const detector_t& det, const field_t& field,
+        const track_candidate_container_types::host& candidates,
+        iteration_histogram* iterations = nullptr) const {
+
+        const std::size_t n_tracks = candidates.size();
+        track_state_container_types::host result =
+            m_fitting(det, field, traccc::get_data(candidates));
+        TUTORIAL_COUNT(kf_updates, n_candidate_measurements(candidates));
+
+        // Tracks still being iterated
+        std::vector<std::size_t> active;
+        std::vector<unsigned int> n_iterations(n_tracks, 1u);
+        for (std::size_t i = 0; i < n_tracks; ++i) {
+            if (result.at(i).header.ndf > 0.f &&
+                !accepted(candidates.at(i).header, result.at(i).header)) {
+                active.push_back(i);
+            }
+        }
+
+        for (unsigned int iteration = 2u;
+             iteration <= m_cfg.max_iterations && !active.empty();
+             ++iteration) {
+
+            // Seed every active track with its last result.
+            track_candidate_container_types::host refit{&m_mr};
+            refit.resize(active.size());
+            for (std::size_t j = 0; j < active.size(); ++j) {
+                bound_track_parameters seed =
+                    result.at(active[j]).header.fit_params;
+                auto covariance = seed.covariance();
+                for (unsigned int a = 0; a < e_bound_size; ++a) {
+                    for (unsigned int b = 0; b < e_bound_size; ++b) {
+                        getter::element(covariance, a, b) *=
+                            m_cfg.covariance_inflation;
+                    }
+                }
+                seed.set_covariance(covariance);
+                refit.at(j).header = seed;
+                for (const measurement& meas :
+                     candidates.at(active[j]).items) {
+                    refit.at(j).items.push_back(meas);
+                }
+            }
+            const track_state_container_types::host refitted =
+                m_fitting(det, field, traccc::get_data(refit));
+            TUTORIAL_COUNT(kf_updates, n_candidate_measurements(refit));
+
+            std::vector<std::size_t> still_active;
+            for (std::size_t j = 0; j < active.size(); ++j) {
+                const std::size_t i = active[j];
+                const fit_result_type previous = result.at(i).header;
+                if (!(refitted.at(j).header.ndf > 0.f)) {
+                    // Keep the last successful fit.
+                    continue;
+                }
+                result.at(i).header = refitted.at(j).header;
+                result.at(i).items.assign(refitted.at(j).items.begin(),
+                                          refitted.at(j).items.end());
+                n_iterations[i] = iteration;
+                if (!converged(previous, result.at(i).header)) {
+                    still_active.push_back(i);
+                }
+            }
+            active.swap(still_active);
+        }
+
+        if (iterations != nullptr) {
+            for (const unsigned int n : n_iterations) {
+                iterations->add(n);
+            }
+        }
+        return result;
+    }
+
+    private:
+    /// The fitter configuration with a single iteration
+    static fitting_config single_iteration(fitting_config cfg) {
+        cfg.n_iterations = 1u;
+        return cfg;
+    }
+
+    /// Whether the first fit of a track needs no refit
+    bool accepted(const bound_track_parameters& seed,
+                  const fit_result_type& fit) const {
+
+        if (fit.chi2 > m_cfg.max_chi2_ndf * fit.ndf) {
+            return false;
+        }
+        return within(fit.fit_params, seed, seed, m_cfg.seed_tolerance);
+    }
+
+    /// Whether a refit moved less than the tolerances from the previous fit
+    bool converged(const fit_result_type& previous,
+                   const fit_result_type& fit) const {
+
+        if (std::abs(fit.chi2 - previous.chi2) >
+            m_cfg.chi2_tolerance * std::max<scalar>(previous.chi2, 1.f)) {
+            return false;
+        }
+        return within(fit.fit_params, previous.fit_params, fit.fit_params,
+                      m_cfg.parameter_tolerance);
+    }
+
+    /// Whether no parameter of @c a differs from that of @c b by more than
+    /// @c tolerance times its uncertainty in @c errors
+    ///
+    /// The difference in phi is taken across the +-pi boundary.
+    ///
+    static bool within(const bound_track_parameters& a,
+                       const bound_track_parameters& b,
+                       const bound_track_parameters& errors,
+                       scalar tolerance) {
+
+        for (unsigned int i = 0; i < e_bound_size; ++i) {
+            const scalar variance =
+                getter::element(errors.covariance(), i, i);
+            scalar change = getter::element(a.vector(), i, 0u) -
+                            getter::element(b.vector(), i, 0u);
+            if (i == e_bound_phi) {
+                change = std::remainder(change, 2 * constant<scalar>::pi);
+            }
+            if (variance > 0.f &&
+                change * change > tolerance * tolerance * variance) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// The convergence configuration
+    adaptive_fitting_config m_cfg;
+    /// Memory resource for the refitted candidates
+    vecmem::memory_resource& m_mr;
+    /// traccc's Kalman fitter, with one iteration
+    host::kalman_fitting_algorithm m_fitting;
+
+};  // class adaptive_kalman_fitting
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,295 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/instrumentation.hpp"
+
+// traccc include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of @c greedy_ambiguity_resolution
+struct ambiguity_resolution_config {
+    /// Largest number of measurements that a kept track may share with
+    /// other kept tracks
+    unsigned int max_shared_measurements = 1u;
+    /// Fewest measurements of a kept track
+    unsigned int min_measurements = 3u;
+};
+
+/// Greedy removal of track candidates that share measurements
+///
+/// Repeatedly removes the candidate with the most shared measurements,
+/// until no candidate shares more than @c max_shared_measurements of its
+/// measurements with the others. Among candidates with as many shared
+/// measurements, the one with the fewest measurements (i.e. the largest
+/// shared fraction) goes first, and after that the one with the highest
+/// index, so the result does not depend on the heap layout.
+///
+/// The number of candidates using every measurement is kept in a flat table
+/// indexed by @c measurement_id, and the candidates in an indexed max-heap
+/// on their number of shared measurements. Removing a candidate decrements
+/// the table for its measurements. Only when a measurement drops to a single
+/// user does that one candidate lose a shared measurement, and only it is
+/// moved in the heap. Nothing is rescanned, so a removal costs the length of
+/// the removed candidate times a heap update.
+///
+class greedy_ambiguity_resolution {
+
+    public:
+    /// Construct the algorithm
+    ///
+    /// @param cfg The configuration
+    /// @param mr  Memory resource for the output candidates
+    ///
+    greedy_ambiguity_resolution(const ambiguity_resolution_config& cfg,
+                                vecmem::memory_resource& mr)
+        : m_cfg(cfg), m_mr(mr) {}
+
+    /// Indices of the candidates that are kept, in increasing order
+    std::vector<std::size_t> select(
+        const track_candidate_container_types::host& candidates) const {
+
+        const std::size_t n_tracks = candidates.size();
+
+        // Measurements of every track, in one flat array
+        std::vector<std::size_t> track_offsets(n_tracks + 1u, 0u);
+        std::vector<unsigned int> track_measurements;
+        std::vector<bool> removed(n_tracks, false);
+        unsigned int n_ids = 0u;
+        for (std::size_t t = 0; t < n_tracks; ++t) {
+            const auto& items = candidates.at(t).items;
+            if (items.size() < m_cfg.min_measurements) {
+                removed[t] = true;
+            } else {
+                for (const measurement& meas : items) {
+                    track_measurements.push_back(meas.measurement_id);
+                    n_ids = std::max(n_ids, meas.measurement_id + 1u);
+                }
+            }
+            track_offsets[t + 1u] = track_measurements.size();
+        }
+
+        // Number of tracks using every measurement, and the tracks
+        // themselves, again in one flat array
+        std::vector<unsigned int> n_users(n_ids, 0u);
+        for (const unsigned int m : track_measurements) {
+            ++n_users[m];
+        }
+        std::vector<std::size_t> user_offsets(n_ids + 1u, 0u);
+        for (unsigned int m = 0; m < n_ids; ++m) {
+            user_offsets[m + 1u] = user_offsets[m] + n_users[m];
+        }
+        std::vector<std::size_t> users(track_measurements.size());
+        {
+            std::vector<std::size_t> fill(user_offsets.begin(),
+                                          user_offsets.end() - 1);
+            for (std::size_t t = 0; t < n_tracks; ++t) {
+                for (std::size_t i = track_offsets[t];
+                     i < track_offsets[t + 1u]; ++i) {
+                    users[fill[track_measurements[i]]++] = t;
+                }
+            }
+        }
+
+        // Shared measurements of every track
+        track_heap heap(n_tracks);
+        for (std::size_t t = 0; t < n_tracks; ++t) {
+            heap.n_measurements[t] = static_cast<unsigned int>(
+                track_offsets[t + 1u] - track_offsets[t]);
+            for (std::size_t i = track_offsets[t]; i < track_offsets[t + 1u];
+                 ++i) {
+                heap.n_shared[t] += (n_users[track_measurements[i]] > 1u);
+            }
+            // Shared measurements only ever decrease, so tracks within the
+            // limit never need to be looked at.
+            if (heap.n_shared[t] > m_cfg.max_shared_measurements) {
+                heap.push(t);
+            }
+        }
+
+        while (!heap.empty()) {
+            const std::size_t worst = heap.top();
+            if (heap.n_shared[worst] <= m_cfg.max_shared_measurements) {
+                break;
+            }
+            heap.pop();
+            removed[worst] = true;
+            TUTORIAL_COUNT(ambiguous_tracks_removed, 1);
+            for (std::size_t i = track_offsets[worst];
+                 i < track_offsets[worst + 1u]; ++i) {
+                const unsigned int m = track_measurements[i];
+                if (--n_users[m] != 1u) {
+                    continue;
+                }
+                // The measurement is no longer shared by its last user.
+                for (std::size_t u = user_offsets[m]; u < user_offsets[m + 1u];
+                     ++u) {
+                    if (!removed[users[u]]) {
+                        --heap.n_shared[users[u]];
+                        heap.update(users[u]);
+                        break;
+                    }
+                }
+            }
+        }
+
+        std::vector<std::size_t> result;
+        for (std::size_t t = 0; t < n_tracks; ++t) {
+            if (!removed[t]) {
+                result.push_back(t);
+            }
+        }
+        return result;
+    }
+
+    /// Remove the ambiguous candidates of an event
+    ///
+    /// @param candidates The track candidates
+    /// @param kept       If not null, receives the indices in @c candidates
+    ///                   of the kept candidates
+    /// @return The kept candidates, in their input order
+    ///
+    track_candidate_container_types::host operator()(
+        const track_candidate_container_types::host& candidates,
+        std::vector<std::size_t>* kept = nullptr) const {
+
+        TUTORIAL_SCOPED_TIMER(ambiguity_resolution);
+        const std::vector<std::size_t> selected = select(candidates);
+        track_candidate_container_types::host result{&m_mr};
+        result.resize(selected.size());
+        for (std::size_t i = 0; i < selected.size(); ++i) {
+            const auto& candidate = candidates.at(selected[i]);
+            result.at(i).header = candidate.header;
+            result.at(i).items.assign(candidate.items.begin(),
+                                      candidate.items.end());
+        }
+        if (kept != nullptr) {
+            *kept = selected;
+        }
+        return result;
+    }
+
+    private:
+    /// Max-heap of tracks on their shared measurements, indexed by track
+    ///
+    /// Every track knows its position in the heap, so a track whose number
+    /// of shared measurements dropped is moved down from where it is.
+    ///
+    struct track_heap {
+
+        static constexpr std::size_t npos =
+            std::numeric_limits<std::size_t>::max();
+
+        explicit track_heap(std::size_t n_tracks)
+            : n_shared(n_tracks, 0u),
+              n_measurements(n_tracks, 0u),
+              position(n_tracks, npos) {}
+
+        bool empty() const { return heap.empty(); }
+        std::size_t top() const { return heap.front(); }
+
+        void push(std::size_t t) {
+            position[t] = heap.size();
+            heap.push_back(t);
+            sift_up(position[t]);
+        }
+
+        void pop() {
+            position[heap.front()] = npos;
+            if (heap.size() > 1u) {
+                heap.front() = heap.back();
+                position[heap.front()] = 0u;
+                heap.pop_back();
+                sift_down(0u);
+            } else {
+                heap.pop_back();
+            }
+        }
+
+        /// Restore the order after the shared measurements of @c t dropped
+        void update(std::size_t t) {
+            if (position[t] != npos) {
+                sift_down(position[t]);
+            }
+        }
+
+        /// Whether track @c a is to be removed before track @c b
+        bool worse(std::size_t a, std::size_t b) const {
+            if (n_shared[a] != n_shared[b]) {
+                return n_shared[a] > n_shared[b];
+            }
+            // Same shared count: the larger shared fraction, i.e. the
+            // shorter track, goes first.
+            if (n_measurements[a] != n_measurements[b]) {
+                return n_measurements[a] < n_measurements[b];
+            }
+            return a > b;
+        }
+
+        void sift_up(std::size_t i) {
+            while (i > 0u) {
+                const std::size_t parent = (i - 1u) / 2u;
+                if (!worse(heap[i], heap[parent])) {
+                    break;
+                }
+                swap(i, parent);
+                i = parent;
+            }
+        }
+
+        void sift_down(std::size_t i) {
+            while (true) {
+                std::size_t largest = i;
+                for (const std::size_t child : {2u * i + 1u, 2u * i + 2u}) {
+                    if (child < heap.size() &&
+                        worse(heap[child], heap[largest])) {
+                        largest = child;
+                    }
+                }
+                if (largest == i) {
+                    break;
+                }
+                swap(i, largest);
+                i = largest;
+            }
+        }
+
+        void swap(std::size_t i, std::size_t j) {
+            std::swap(heap[i], heap[j]);
+            position[heap[i]] = i;
+            position[heap[j]] = j;
+        }
+
+        std::vector<unsigned int> n_shared;
+        std::vector<unsigned int> n_measurements;
+        std::vector<std::size_t> position;
+        std::vector<std::size_t> heap;
+    };
+
+    /// The configuration
+    ambiguity_resolution_config m_cfg;
+    /// Memory resource for the output candidates
+    vecmem::memory_resource& m_mr;
+
+};  // class greedy_ambiguity_resolution
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,237 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Allocation statistics of an arena, for one event
+struct arena_statistics {
+    /// Bytes handed out since the last reset
+    std::size_t bytes_allocated = 0;
+    /// Number of allocations since the last reset
+    std::size_t n_allocations = 0;
+    /// Highest number of bytes in use (allocated and not yet deallocated)
+    std::size_t high_water_mark = 0;
+    /// Number of blocks requested from the upstream resource while serving
+    /// allocations; the block that @c reset() merges the blocks into is not
+    /// counted
+    std::size_t n_upstream_allocations = 0;
+};
+
+/// Monotonic arena memory resource, meant to be reset after every event
+///
+/// Allocations are served by bumping a pointer through large blocks taken
+/// from an upstream resource, and deallocations are no-ops. @c reset()
+/// rewinds the arena without giving the blocks back. If an event needed more
+/// than one block, the blocks are merged into a single one on reset, so after
+/// the first few events the arena serves every event from one block without
+/// touching the upstream resource at all.
+///
+/// All memory handed out since the last reset must have been released (the
+/// containers destroyed) before calling @c reset().
+///
+class arena_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Construct the arena
+    ///
+    /// @param upstream   The resource to take the blocks from
+    /// @param block_size The size of the first block
+    ///
+    explicit arena_memory_resource(vecmem::memory_resource& upstream,
+                                   std::size_t block_size = 1024u * 1024u)
+        : m_upstream(upstream), m_block_size(block_size) {}
+
+    /// Give all blocks back to the upstream resource
+    ~arena_memory_resource() override { release(); }
+
+    arena_memory_resource(const arena_memory_resource&) = delete;
+    arena_memory_resource& operator=(const arena_memory_resource&) = delete;
+
+    /// Rewind the arena for the next event
+    void reset() {
+        if (m_blocks.size() > 1u) {
+            std::size_t total = 0;
+            for (const auto& b : m_blocks) {
+                total += b.size;
+            }
+            release();
+            m_block_size = std::max(m_block_size, total);
+            allocate_block(m_block_size);
+        }
+        // The merged block is taken between two events and replaces blocks
+        // that the last event already counted, so it is not counted for
+        // the next one: the statistics are cleared only now.
+        m_stats = {};
+        m_current = 0;
+        m_offset = 0;
+        m_live_bytes = 0;
+    }
+
+    /// Statistics of the allocations since the last reset
+    const arena_statistics& statistics() const { return m_stats; }
+
+    /// Total size of the blocks currently owned by the arena
+    std::size_t capacity() const {
+        std::size_t result = 0;
+        for (const auto& b : m_blocks) {
+            result += b.size;
+        }
+        return result;
+    }
+
+    private:
+    /// One block of memory from the upstream resource
+    struct block {
+        std::byte* ptr;
+        std::size_t size;
+    };
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+
+        while (true) {
+            if (m_current < m_blocks.size()) {
+                const block& b = m_blocks[m_current];
+                const auto base = reinterpret_cast<std::uintptr_t>(b.ptr);
+                const std::size_t offset =
+                    ((base + m_offset + alignment - 1u) & ~(alignment - 1u)) -
+                    base;
+                if (offset + bytes <= b.size) {
+                    m_offset = offset + bytes;
+                    m_stats.bytes_allocated += bytes;
+                    ++m_stats.n_allocations;
+                    m_live_bytes += bytes;
+                    m_stats.high_water_mark =
+                        std::max(m_stats.high_water_mark, m_live_bytes);
+                    return b.ptr + offset;
+                }
+                // Move on to the next block, if there is one.
+                if (m_current + 1u < m_blocks.size()) {
+                    ++m_current;
+                    m_offset = 0;
+                    continue;
+                }
+            }
+            // Grow geometrically, so that a large event needs few blocks.
+            if (!m_blocks.empty()) {
+                m_block_size *= 2u;
+            }
+            m_block_size = std::max(m_block_size, bytes + alignment);
+            allocate_block(m_block_size);
+            m_current = m_blocks.size() - 1u;
+            m_offset = 0;
+        }
+    }
+
+    void do_deallocate(void*, std::size_t bytes, std::size_t) override {
+        m_live_bytes -= std::min(bytes, m_live_bytes);
+    }
+
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    /// Take a new block from the upstream resource
+    void allocate_block(std::size_t size) {
+        m_blocks.push_back(
+            {static_cast<std::byte*>(
+                 m_upstream.allocate(size, alignof(std::max_align_t))),
+             size});
+        ++m_stats.n_upstream_allocations;
+    }
+
+    /// Give all blocks back to the upstream resource
+    void release() {
+        for (const auto& b : m_blocks) {
+            m_upstream.deallocate(b.ptr, b.size, alignof(std::max_align_t));
+        }
+        m_blocks.clear();
+    }
+
+    /// The resource the blocks come from
+    vecmem::memory_resource& m_upstream;
+    /// Size of newly allocated blocks
+    std::size_t m_block_size;
+    /// The blocks owned by the arena
+    std::vector<block> m_blocks;
+    /// Index of the block allocations are currently served from
+    std::size_t m_current = 0;
+    /// Offset of the first free byte in the current block
+    std::size_t m_offset = 0;
+    /// Bytes currently in use
+    std::size_t m_live_bytes = 0;
+    /// Statistics since the last reset
+    arena_statistics m_stats;
+
+};  // class arena_memory_resource
+
+/// Counter of the allocations from the default memory resource
+///
+/// Containers that are not given a memory resource, such as the outputs of
+/// algorithms that do not take one, allocate from the default resource and
+/// never reach an arena. While the counter exists, it is installed as the
+/// default resource and counts these allocations per thread, so that a
+/// worker can tell the allocations of its own event from those of the
+/// events on other threads.
+///
+class default_resource_counter : public vecmem::memory_resource {
+
+    public:
+    /// Install the counter as the default memory resource
+    default_resource_counter()
+        : m_upstream(*std::pmr::get_default_resource()) {
+        std::pmr::set_default_resource(this);
+    }
+
+    /// Restore the previous default memory resource
+    ~default_resource_counter() override {
+        std::pmr::set_default_resource(&m_upstream);
+    }
+
+    default_resource_counter(const default_resource_counter&) = delete;
+    default_resource_counter& operator=(const default_resource_counter&) =
+        delete;
+
+    /// Allocations from the default resource by the calling thread so far
+    static std::size_t thread_allocations() { return t_allocations; }
+
+    private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++t_allocations;
+        return m_upstream.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override {
+        m_upstream.deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    /// The default resource before this one
+    vecmem::memory_resource& m_upstream;
+    /// Allocations of the thread
+    static inline thread_local std::size_t t_allocations = 0;
+
+};  // class default_resource_counter
+
+}  // namespace traccc::tutorial
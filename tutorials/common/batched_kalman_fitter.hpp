@@ -0,0 +1,800 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/detector_utils.hpp"
+#include "common/instrumentation.hpp"
+#include "common/simd_lanes.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/track_candidate.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of the batched Kalman fitter
+struct batched_fitter_config {
+
+    /// Longest step of the track transport between two planes
+    double max_step = 10. * unit<double>::mm;
+
+    /// Material of every plane, in radiation lengths (80 um of silicon)
+    double x_over_x0 = 0.08 / 93.7;
+
+    /// @name Uncertainties of the starting parameters
+    /// @{
+    double seed_sigma_position = 1. * unit<double>::mm;
+    double seed_sigma_slope = 0.05;
+    /// Relative to the seed's q/p
+    double seed_sigma_qop = 0.5;
+    /// @}
+
+};  // struct batched_fitter_config
+
+/// Result of fitting one track with @c batched_kalman_fitter
+///
+/// The parameters are (y, z, dy/dx, dz/dx, q/p), expressed on the plane of
+/// the first measurement of the track (at global x = @c x).
+///
+template <typename scalar_t>
+struct batched_fit_result {
+    /// Global x of the reference plane
+    scalar_t x = 0;
+    /// Smoothed parameters on the reference plane
+    std::array<scalar_t, 5> params{};
+    /// Their covariance, row-major
+    std::array<scalar_t, 25> covariance{};
+    /// Sum of the filter residuals' chi2
+    scalar_t chi2 = 0;
+    /// Degrees of freedom; zero if the track was too short to be fitted
+    unsigned int ndf = 0;
+
+    /// Momentum of the (unit charge) particle
+    scalar_t p() const { return std::abs(scalar_t{1} / params[4]); }
+
+};  // struct batched_fit_result
+
+/// Forward filter states of one track, handed over by a track finder
+///
+/// One entry per measurement, in the order of the filter. The states are
+/// those that @c batched_kalman_fitter computes in its forward filter, so
+/// @c batched_kalman_fitter::smooth_filtered can skip straight to the
+/// smoother.
+///
+template <typename scalar_t>
+struct filtered_track {
+
+    /// The states on the plane of one measurement
+    struct plane_state {
+        /// Global x of the plane
+        scalar_t x = 0;
+        /// Predicted parameters and covariance (row-major)
+        std::array<scalar_t, 5> predicted{};
+        std::array<scalar_t, 25> predicted_covariance{};
+        /// Filtered parameters and covariance (row-major)
+        std::array<scalar_t, 5> filtered{};
+        std::array<scalar_t, 25> filtered_covariance{};
+        /// Transport Jacobian from the previous plane (row-major)
+        std::array<scalar_t, 25> jacobian{};
+    };
+
+    /// States of every measurement of the track
+    std::vector<plane_state> states;
+    /// Sum of the filter residuals' chi2
+    scalar_t chi2 = 0;
+
+};  // struct filtered_track
+
+/// Kalman fitter processing @c LANES tracks at once
+///
+/// The fitter implements the forward filter and the RTS smoother of a track
+/// crossing planes perpendicular to the global x-axis in a field along z,
+/// which is the geometry of the tutorial's telescope. Tracks are described
+/// by (y, z, dy/dx, dz/dx, q/p), transported between planes with second
+/// order steps of at most @c batched_fitter_config::max_step, and scattered
+/// on every plane according to the Highland formula.
+///
+/// All of the arithmetic is done on @c lanes<scalar_t, LANES>, so the state
+/// vectors, covariances and Jacobians of @c LANES tracks sit next to each
+/// other in memory (AoSoA) and every operation runs over all lanes with
+/// SIMD instructions. Tracks are grouped into batches of equal length, so no
+/// lane ever waits for another one; a partial last batch is padded with
+/// copies of one of its tracks. @c LANES = 1 is the plain scalar fitter, and
+/// since every lane performs exactly the same operations as the scalar code,
+/// the results do not depend on @c LANES (up to floating point contraction
+/// differences allowed by the compiler flags).
+///
+template <std::size_t LANES, typename scalar_t = double>
+class batched_kalman_fitter {
+
+    public:
+    /// Type holding one value of every lane
+    using value_type = lanes<scalar_t, LANES>;
+    /// Fit result type
+    using result_type = batched_fit_result<scalar_t>;
+    /// Number of tracks fitted at once
+    static constexpr std::size_t n_lanes = LANES;
+    /// Forward filter states handed over by a track finder
+    using filtered_track_type = filtered_track<scalar_t>;
+
+    /// Construct the fitter for the given planes
+    ///
+    /// @param cfg     The fitter configuration
+    /// @param modules The sensitive modules, which have to be perpendicular
+    ///                to the x-axis
+    /// @param B       The (constant) magnetic field, which has to be along z
+    ///
+    batched_kalman_fitter(const batched_fitter_config& cfg,
+                          const std::vector<module_placement>& modules,
+                          const vector3& B)
+        : m_cfg(cfg), m_bz(static_cast<scalar_t>(B[2])) {
+
+        if (B[0] != 0.f || B[1] != 0.f) {
+            throw std::invalid_argument(
+                "The batched fitter needs a magnetic field along z");
+        }
+        for (const auto& module : modules) {
+            const auto& trf = module.transform;
+            if (std::abs(std::abs(trf.z()[0]) - 1.f) > 1e-6f) {
+                throw std::invalid_argument(
+                    "The batched fitter needs planes perpendicular to x");
+            }
+            plane pl;
+            pl.x = static_cast<scalar_t>(trf.translation()[0]);
+            pl.a = {static_cast<scalar_t>(trf.x()[1]),
+                    static_cast<scalar_t>(trf.y()[1]),
+                    static_cast<scalar_t>(trf.x()[2]),
+                    static_cast<scalar_t>(trf.y()[2])};
+            pl.t = {static_cast<scalar_t>(trf.translation()[1]),
+                    static_cast<scalar_t>(trf.translation()[2])};
+            m_plane_index.emplace(module.barcode.value(), m_planes.size());
+            m_planes.push_back(pl);
+        }
+    }
+
+    /// Fit track candidates
+    ///
+    /// @param candidates The track candidates, e.g. from the CKF; their
+    ///                   headers provide the starting direction and q/p
+    /// @return One result per candidate, in the order of @c candidates
+    ///
+    std::vector<result_type> operator()(
+        const track_candidate_container_types::host& candidates) const {
+
+        std::vector<result_type> results(candidates.size());
+        std::vector<track_input> tracks;
+        std::vector<measurement_input> meas;
+        prepare(candidates, tracks, meas);
+
+        // Batches of tracks with the same number of measurements
+        std::stable_sort(tracks.begin(), tracks.end(),
+                         [](const track_input& a, const track_input& b) {
+                             return a.n < b.n;
+                         });
+        workspace ws;
+        for (std::size_t begin = 0; begin < tracks.size();) {
+            const unsigned int n = tracks[begin].n;
+            std::size_t end = begin;
+            while (end < tracks.size() && end - begin < LANES &&
+                   tracks[end].n == n) {
+                ++end;
+            }
+            if (n >= 3u) {
+                std::array<const track_input*, LANES> batch;
+                for (std::size_t l = 0; l < LANES; ++l) {
+                    batch[l] = &tracks[std::min(begin + l, end - 1u)];
+                }
+                fit_batch(batch, end - begin, n, meas, ws, results);
+            }
+            begin = end;
+        }
+        return results;
+    }
+
+    /// Smooth tracks whose forward filter was run by a track finder
+    ///
+    /// Only runs the RTS smoother, on the states handed over by the finder,
+    /// instead of transporting and filtering the measurements again.
+    ///
+    /// @param tracks The forward filter states, e.g. from
+    ///               @c telescope_track_finding
+    /// @return One result per track, in the order of @c tracks
+    ///
+    std::vector<result_type> smooth_filtered(
+        const std::vector<filtered_track_type>& tracks) const {
+
+        std::vector<result_type> results(tracks.size());
+        std::vector<std::size_t> order(tracks.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(),
+                         [&tracks](std::size_t a, std::size_t b) {
+                             return tracks[a].states.size() <
+                                    tracks[b].states.size();
+                         });
+        workspace ws;
+        for (std::size_t begin = 0; begin < order.size();) {
+            const std::size_t n = tracks[order[begin]].states.size();
+            std::size_t end = begin;
+            while (end < order.size() && end - begin < LANES &&
+                   tracks[order[end]].states.size() == n) {
+                ++end;
+            }
+            if (n >= 3u) {
+                std::array<std::size_t, LANES> batch;
+                for (std::size_t l = 0; l < LANES; ++l) {
+                    batch[l] = order[std::min(begin + l, end - 1u)];
+                }
+                smooth_batch(tracks, batch, end - begin,
+                             static_cast<unsigned int>(n), ws, results);
+            }
+            begin = end;
+        }
+        return results;
+    }
+
+    private:
+    /// A plane of the telescope
+    struct plane {
+        /// Position along x
+        scalar_t x;
+        /// Local-to-(y, z) rotation, row-major
+        std::array<scalar_t, 4> a;
+        /// (y, z) of the local origin
+        std::array<scalar_t, 2> t;
+    };
+
+    /// A measurement, converted to (y, z) on its plane
+    struct measurement_input {
+        scalar_t x, y, z, vyy, vyz, vzz;
+    };
+
+    /// A track to fit
+    struct track_input {
+        /// Index of the track candidate
+        std::size_t index;
+        /// Its measurements in @c measurement_input
+        std::size_t begin;
+        unsigned int n;
+        /// Starting direction and q/p
+        scalar_t ty, tz, qop;
+    };
+
+    /// Parameters and covariance of @c LANES tracks
+    struct batch_state {
+        value_type x[5];
+        value_type C[5][5];
+    };
+
+    /// A 5x5 matrix of @c LANES tracks
+    struct batch_matrix {
+        value_type m[5][5];
+    };
+
+    /// Per-plane states of a batch, kept for the smoother
+    struct workspace {
+        std::vector<batch_state> predicted, filtered, smoothed;
+        /// Transport Jacobian from the previous plane
+        std::vector<batch_matrix> jacobian;
+        void resize(std::size_t n) {
+            predicted.resize(n);
+            filtered.resize(n);
+            smoothed.resize(n);
+            jacobian.resize(n);
+        }
+    };
+
+    public:
+    /// @name Forward filter steps, for a track finder
+    ///
+    /// With @c LANES = 1, these are the steps of the forward filter of
+    /// @c operator() on a single track. A track finder filtering its branches
+    /// with them produces the states that @c smooth_filtered expects.
+    ///
+    /// @{
+
+    /// State of the filter on one plane
+    using state_type = batch_state;
+    /// Transport Jacobian between two planes
+    using jacobian_type = batch_matrix;
+    /// A measurement in (y, z) on its plane
+    using plane_measurement = measurement_input;
+
+    /// Convert a measurement to (y, z) on its plane
+    plane_measurement convert(const measurement& m) const {
+        const plane& pl = m_planes.at(m_plane_index.at(m.surface_link.value()));
+        const scalar_t l0 = static_cast<scalar_t>(m.local[0]);
+        const scalar_t l1 = static_cast<scalar_t>(m.local[1]);
+        const scalar_t v0 = static_cast<scalar_t>(m.variance[0]);
+        const scalar_t v1 = static_cast<scalar_t>(m.variance[1]);
+        measurement_input in;
+        in.x = pl.x;
+        in.y = pl.a[0] * l0 + pl.a[1] * l1 + pl.t[0];
+        in.z = pl.a[2] * l0 + pl.a[3] * l1 + pl.t[1];
+        in.vyy = pl.a[0] * pl.a[0] * v0 + pl.a[1] * pl.a[1] * v1;
+        in.vyz = pl.a[0] * pl.a[2] * v0 + pl.a[1] * pl.a[3] * v1;
+        in.vzz = pl.a[2] * pl.a[2] * v0 + pl.a[3] * pl.a[3] * v1;
+        return in;
+    }
+
+    /// Starting state of the filter on the plane of its first measurement
+    ///
+    /// @param first The first measurement
+    /// @param seed  Starting direction and q/p, as in a candidate header
+    ///
+    state_type start_state(const plane_measurement& first,
+                           const bound_track_parameters& seed) const {
+        const scalar_t phi = static_cast<scalar_t>(seed.phi());
+        const scalar_t theta = static_cast<scalar_t>(seed.theta());
+        state_type start;
+        start.x[0] = value_type::broadcast(first.y);
+        start.x[1] = value_type::broadcast(first.z);
+        start.x[2] = value_type::broadcast(std::tan(phi));
+        start.x[3] = value_type::broadcast(std::cos(theta) /
+                                           (std::cos(phi) * std::sin(theta)));
+        start.x[4] = value_type::broadcast(static_cast<scalar_t>(seed.qop()));
+        set_start_covariance(start);
+        return start;
+    }
+
+    /// Transport a filtered state over @c dx, scattering on its plane
+    void predict_state(const state_type& filtered, const value_type& dx,
+                       jacobian_type& J, state_type& predicted) const {
+        state_type scattered = filtered;
+        add_scattering(scattered);
+        predict(scattered, dx, J.m, predicted);
+    }
+
+    /// Chi2 of a measurement with respect to a predicted state
+    static value_type residual_chi2(const state_type& predicted,
+                                    const plane_measurement& m) {
+        const value_type s00 =
+            predicted.C[0][0] + value_type::broadcast(m.vyy);
+        const value_type s01 =
+            predicted.C[0][1] + value_type::broadcast(m.vyz);
+        const value_type s11 =
+            predicted.C[1][1] + value_type::broadcast(m.vzz);
+        const value_type r0 = value_type::broadcast(m.y) - predicted.x[0];
+        const value_type r1 = value_type::broadcast(m.z) - predicted.x[1];
+        return (s11 * r0 * r0 - static_cast<scalar_t>(2) * s01 * r0 * r1 +
+                s00 * r1 * r1) /
+               (s00 * s11 - s01 * s01);
+    }
+
+    /// Kalman update of a state with a measurement, adding to @c chi2
+    static void update_state(state_type& s, const plane_measurement& m,
+                             value_type& chi2) {
+        update(s, value_type::broadcast(m.y), value_type::broadcast(m.z),
+               value_type::broadcast(m.vyy), value_type::broadcast(m.vyz),
+               value_type::broadcast(m.vzz), chi2);
+    }
+
+    /// @}
+
+    private:
+
+    /// Convert the candidates into flat, per-track inputs
+    void prepare(const track_candidate_container_types::host& candidates,
+                 std::vector<track_input>& tracks,
+                 std::vector<measurement_input>& meas) const {
+
+        tracks.reserve(candidates.size());
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            const auto& header = candidates.at(i).header;
+            const auto& items = candidates.at(i).items;
+
+            const scalar_t phi = static_cast<scalar_t>(header.phi());
+            const scalar_t theta = static_cast<scalar_t>(header.theta());
+            track_input trk;
+            trk.index = i;
+            trk.begin = meas.size();
+            trk.n = static_cast<unsigned int>(items.size());
+            trk.ty = std::tan(phi);
+            trk.tz = std::cos(theta) / (std::cos(phi) * std::sin(theta));
+            trk.qop = static_cast<scalar_t>(header.qop());
+            tracks.push_back(trk);
+
+            for (const measurement& m : items) {
+                meas.push_back(convert(m));
+            }
+        }
+    }
+
+    /// Fit one batch of tracks with @c n measurements each
+    void fit_batch(const std::array<const track_input*, LANES>& batch,
+                   std::size_t n_valid, unsigned int n,
+                   const std::vector<measurement_input>& meas, workspace& ws,
+                   std::vector<result_type>& results) const {
+
+        TUTORIAL_SCOPED_TIMER(batched_fit_batch);
+        TUTORIAL_COUNT(kf_updates, n_valid * n);
+        ws.resize(n);
+        const auto gather = [&](auto&& f) {
+            value_type v;
+            for (std::size_t l = 0; l < LANES; ++l) {
+                v[l] = f(*batch[l]);
+            }
+            return v;
+        };
+        const auto gather_meas = [&](unsigned int j, auto member) {
+            return gather([&](const track_input& trk) {
+                return meas[trk.begin + j].*member;
+            });
+        };
+
+        // Starting parameters on the first plane
+        batch_state& start = ws.predicted[0];
+        start.x[0] = gather_meas(0u, &measurement_input::y);
+        start.x[1] = gather_meas(0u, &measurement_input::z);
+        start.x[2] = gather([](const track_input& t) { return t.ty; });
+        start.x[3] = gather([](const track_input& t) { return t.tz; });
+        start.x[4] = gather([](const track_input& t) { return t.qop; });
+        set_start_covariance(start);
+
+        // Forward filter
+        value_type chi2 = value_type::broadcast(0);
+        for (unsigned int j = 0; j < n; ++j) {
+            if (j > 0u) {
+                batch_state scattered = ws.filtered[j - 1u];
+                add_scattering(scattered);
+                const value_type dx = gather_meas(j, &measurement_input::x) -
+                                      gather_meas(j - 1u, &measurement_input::x);
+                predict(scattered, dx, ws.jacobian[j].m, ws.predicted[j]);
+            }
+            ws.filtered[j] = ws.predicted[j];
+            update(ws.filtered[j], gather_meas(j, &measurement_input::y),
+                   gather_meas(j, &measurement_input::z),
+                   gather_meas(j, &measurement_input::vyy),
+                   gather_meas(j, &measurement_input::vyz),
+                   gather_meas(j, &measurement_input::vzz), chi2);
+        }
+
+        // Backward (RTS) smoother
+        smooth(ws, n);
+
+        std::array<std::size_t, LANES> indices;
+        for (std::size_t l = 0; l < LANES; ++l) {
+            indices[l] = batch[l]->index;
+        }
+        store_results(indices, n_valid, n,
+                      gather_meas(0u, &measurement_input::x), chi2, ws,
+                      results);
+    }
+
+    /// Smooth one batch of handed over tracks with @c n states each
+    void smooth_batch(const std::vector<filtered_track_type>& tracks,
+                      const std::array<std::size_t, LANES>& batch,
+                      std::size_t n_valid, unsigned int n, workspace& ws,
+                      std::vector<result_type>& results) const {
+
+        ws.resize(n);
+        value_type x0, chi2;
+        for (std::size_t l = 0; l < LANES; ++l) {
+            const filtered_track_type& trk = tracks[batch[l]];
+            x0[l] = trk.states.front().x;
+            chi2[l] = trk.chi2;
+            for (unsigned int j = 0; j < n; ++j) {
+                const auto& st = trk.states[j];
+                for (std::size_t i = 0; i < 5u; ++i) {
+                    ws.predicted[j].x[i][l] = st.predicted[i];
+                    ws.filtered[j].x[i][l] = st.filtered[i];
+                    for (std::size_t k = 0; k < 5u; ++k) {
+                        ws.predicted[j].C[i][k][l] =
+                            st.predicted_covariance[i * 5u + k];
+                        ws.filtered[j].C[i][k][l] =
+                            st.filtered_covariance[i * 5u + k];
+                        ws.jacobian[j].m[i][k][l] = st.jacobian[i * 5u + k];
+                    }
+                }
+            }
+        }
+        smooth(ws, n);
+        store_results(batch, n_valid, n, x0, chi2, ws, results);
+    }
+
+    /// Write the smoothed states on the first plane of a batch
+    static void store_results(const std::array<std::size_t, LANES>& indices,
+                              std::size_t n_valid, unsigned int n,
+                              const value_type& x0, const value_type& chi2,
+                              const workspace& ws,
+                              std::vector<result_type>& results) {
+
+        const batch_state& first = ws.smoothed[0];
+        for (std::size_t l = 0; l < n_valid; ++l) {
+            result_type& res = results[indices[l]];
+            res.x = x0[l];
+            for (std::size_t i = 0; i < 5u; ++i) {
+                res.params[i] = first.x[i][l];
+                for (std::size_t k = 0; k < 5u; ++k) {
+                    res.covariance[i * 5u + k] = first.C[i][k][l];
+                }
+            }
+            res.chi2 = chi2[l];
+            res.ndf = 2u * n - 5u;
+        }
+    }
+
+    /// Set the covariance of a starting state, for its q/p
+    void set_start_covariance(batch_state& start) const {
+        set_zero(start.C);
+        const auto sigma_pos = static_cast<scalar_t>(m_cfg.seed_sigma_position);
+        const auto sigma_slope = static_cast<scalar_t>(m_cfg.seed_sigma_slope);
+        const auto sigma_qop =
+            static_cast<scalar_t>(m_cfg.seed_sigma_qop) * abs(start.x[4]);
+        start.C[0][0] = value_type::broadcast(sigma_pos * sigma_pos);
+        start.C[1][1] = start.C[0][0];
+        start.C[2][2] = value_type::broadcast(sigma_slope * sigma_slope);
+        start.C[3][3] = start.C[2][2];
+        start.C[4][4] = sigma_qop * sigma_qop;
+    }
+
+    /// Add the multiple scattering on a plane to the slope covariance
+    void add_scattering(batch_state& s) const {
+
+        if (m_cfg.x_over_x0 <= 0.) {
+            return;
+        }
+        const value_type& ty = s.x[2];
+        const value_type& tz = s.x[3];
+        const value_type norm2 = value_type::broadcast(1) + ty * ty + tz * tz;
+        // Material traversed at the track's inclination
+        const value_type t =
+            static_cast<scalar_t>(m_cfg.x_over_x0) * sqrt(norm2);
+        const value_type highland =
+            static_cast<scalar_t>(13.6 * unit<double>::MeV) * abs(s.x[4]) *
+            sqrt(t) *
+            (value_type::broadcast(1) + static_cast<scalar_t>(0.038) * log(t));
+        const value_type var = highland * highland * norm2;
+        s.C[2][2] += var * (value_type::broadcast(1) + ty * ty);
+        s.C[3][3] += var * (value_type::broadcast(1) + tz * tz);
+        s.C[2][3] += var * ty * tz;
+        s.C[3][2] += var * ty * tz;
+    }
+
+    /// Transport a state over @c dx, with the transport Jacobian @c J
+    void predict(const batch_state& in, const value_type& dx,
+                 value_type (&J)[5][5], batch_state& out) const {
+
+        // Every lane takes its own number of equal steps. Lanes that are
+        // done take steps of zero length, which leave them unchanged, so a
+        // track's result does not depend on the other tracks of the batch.
+        value_type h;
+        std::array<unsigned int, LANES> n_steps;
+        unsigned int max_steps = 1u;
+        for (std::size_t l = 0; l < LANES; ++l) {
+            n_steps[l] = std::max(
+                1u, static_cast<unsigned int>(std::ceil(
+                        std::abs(dx[l]) / static_cast<scalar_t>(m_cfg.max_step))));
+            h[l] = dx[l] / static_cast<scalar_t>(n_steps[l]);
+            max_steps = std::max(max_steps, n_steps[l]);
+        }
+
+        set_identity(J);
+        std::copy(std::begin(in.x), std::end(in.x), std::begin(out.x));
+        for (unsigned int step = 0; step < max_steps; ++step) {
+            value_type hs = h;
+            for (std::size_t l = 0; l < LANES; ++l) {
+                if (step >= n_steps[l]) {
+                    hs[l] = 0;
+                }
+            }
+            transport_step(out.x, hs, J);
+        }
+
+        // C' = J C J^T
+        value_type tmp[5][5];
+        multiply(J, in.C, tmp);
+        multiply_transposed(tmp, J, out.C);
+    }
+
+    /// One second order step of length @c h, accumulating the Jacobian
+    void transport_step(value_type (&x)[5], const value_type& h,
+                        value_type (&J)[5][5]) const {
+
+        const value_type one = value_type::broadcast(1);
+        const value_type& ty = x[2];
+        const value_type& tz = x[3];
+        const value_type& qop = x[4];
+
+        // Curvature terms: (dy/dx)'' = qop * ay, (dz/dx)'' = qop * az
+        const value_type norm = sqrt(one + ty * ty + tz * tz);
+        const value_type ty2 = one + ty * ty;
+        const value_type bz = value_type::broadcast(m_bz);
+        const value_type ay = -(norm * bz * ty2);
+        const value_type az = -(norm * bz * ty * tz);
+        const value_type day_dty =
+            -(bz * (ty / norm * ty2 + static_cast<scalar_t>(2) * norm * ty));
+        const value_type day_dtz = -(bz * tz / norm * ty2);
+        const value_type daz_dty = -(bz * (ty / norm * ty * tz + norm * tz));
+        const value_type daz_dtz = -(bz * (tz / norm * ty * tz + norm * ty));
+
+        const value_type h2 = static_cast<scalar_t>(0.5) * h * h;
+        value_type f[5][5];
+        set_identity(f);
+        f[0][2] = h + h2 * qop * day_dty;
+        f[0][3] = h2 * qop * day_dtz;
+        f[0][4] = h2 * ay;
+        f[1][2] = h2 * qop * daz_dty;
+        f[1][3] = h + h2 * qop * daz_dtz;
+        f[1][4] = h2 * az;
+        f[2][2] = one + h * qop * day_dty;
+        f[2][3] = h * qop * day_dtz;
+        f[2][4] = h * ay;
+        f[3][2] = h * qop * daz_dty;
+        f[3][3] = one + h * qop * daz_dtz;
+        f[3][4] = h * az;
+
+        x[0] += ty * h + h2 * qop * ay;
+        x[1] += tz * h + h2 * qop * az;
+        x[2] += h * qop * ay;
+        x[3] += h * qop * az;
+
+        value_type tmp[5][5];
+        multiply(f, J, tmp);
+        std::copy(&tmp[0][0], &tmp[0][0] + 25, &J[0][0]);
+    }
+
+    /// Kalman update with a (y, z) measurement
+    static void update(batch_state& s, const value_type& my,
+                       const value_type& mz, const value_type& vyy,
+                       const value_type& vyz, const value_type& vzz,
+                       value_type& chi2) {
+
+        // Residual covariance and its inverse
+        const value_type s00 = s.C[0][0] + vyy;
+        const value_type s01 = s.C[0][1] + vyz;
+        const value_type s11 = s.C[1][1] + vzz;
+        const value_type inv_det =
+            value_type::broadcast(1) / (s00 * s11 - s01 * s01);
+        const value_type i00 = s11 * inv_det;
+        const value_type i01 = -(s01 * inv_det);
+        const value_type i11 = s00 * inv_det;
+
+        const value_type r0 = my - s.x[0];
+        const value_type r1 = mz - s.x[1];
+        chi2 += r0 * (i00 * r0 + i01 * r1) + r1 * (i01 * r0 + i11 * r1);
+
+        // Gain K = C H^T S^-1, with H selecting (y, z)
+        value_type k0[5], k1[5];
+        for (std::size_t i = 0; i < 5u; ++i) {
+            k0[i] = s.C[i][0] * i00 + s.C[i][1] * i01;
+            k1[i] = s.C[i][0] * i01 + s.C[i][1] * i11;
+        }
+        for (std::size_t i = 0; i < 5u; ++i) {
+            s.x[i] += k0[i] * r0 + k1[i] * r1;
+        }
+        const batch_state prior = s;
+        for (std::size_t i = 0; i < 5u; ++i) {
+            for (std::size_t k = 0; k < 5u; ++k) {
+                s.C[i][k] -= k0[i] * prior.C[0][k] + k1[i] * prior.C[1][k];
+            }
+        }
+    }
+
+    /// RTS smoother over the filtered states of a batch
+    static void smooth(workspace& ws, unsigned int n) {
+
+        ws.smoothed[n - 1u] = ws.filtered[n - 1u];
+        for (unsigned int j = n - 1u; j-- > 0u;) {
+            const batch_state& filt = ws.filtered[j];
+            const batch_state& pred = ws.predicted[j + 1u];
+            const batch_state& next = ws.smoothed[j + 1u];
+            batch_state& out = ws.smoothed[j];
+
+            // G = C_filt J^T C_pred^-1
+            value_type inv[5][5], tmp[5][5], G[5][5];
+            std::copy(&pred.C[0][0], &pred.C[0][0] + 25, &inv[0][0]);
+            invert(inv);
+            multiply_transposed(filt.C, ws.jacobian[j + 1u].m, tmp);
+            multiply(tmp, inv, G);
+
+            value_type dC[5][5];
+            for (std::size_t i = 0; i < 5u; ++i) {
+                out.x[i] = filt.x[i];
+                for (std::size_t k = 0; k < 5u; ++k) {
+                    out.x[i] += G[i][k] * (next.x[k] - pred.x[k]);
+                    dC[i][k] = next.C[i][k] - pred.C[i][k];
+                }
+            }
+            multiply(G, dC, tmp);
+            multiply_transposed(tmp, G, out.C);
+            for (std::size_t i = 0; i < 5u; ++i) {
+                for (std::size_t k = 0; k < 5u; ++k) {
+                    out.C[i][k] += filt.C[i][k];
+                }
+            }
+        }
+    }
+
+    /// @name 5x5 matrix helpers
+    /// @{
+    static void set_zero(value_type (&m)[5][5]) {
+        for (auto& row : m) {
+            std::fill(std::begin(row), std::end(row),
+                      value_type::broadcast(0));
+        }
+    }
+    static void set_identity(value_type (&m)[5][5]) {
+        set_zero(m);
+        for (std::size_t i = 0; i < 5u; ++i) {
+            m[i][i] = value_type::broadcast(1);
+        }
+    }
+    /// out = a b
+    static void multiply(const value_type (&a)[5][5],
+                         const value_type (&b)[5][5], value_type (&out)[5][5]) {
+        for (std::size_t i = 0; i < 5u; ++i) {
+            for (std::size_t k = 0; k < 5u; ++k) {
+                value_type sum = a[i][0] * b[0][k];
+                for (std::size_t m = 1; m < 5u; ++m) {
+                    sum += a[i][m] * b[m][k];
+                }
+                out[i][k] = sum;
+            }
+        }
+    }
+    /// out = a b^T
+    static void multiply_transposed(const value_type (&a)[5][5],
+                                    const value_type (&b)[5][5],
+                                    value_type (&out)[5][5]) {
+        for (std::size_t i = 0; i < 5u; ++i) {
+            for (std::size_t k = 0; k < 5u; ++k) {
+                value_type sum = a[i][0] * b[k][0];
+                for (std::size_t m = 1; m < 5u; ++m) {
+                    sum += a[i][m] * b[k][m];
+                }
+                out[i][k] = sum;
+            }
+        }
+    }
+    /// In-place Gauss-Jordan inversion of a symmetric positive definite
+    /// matrix, which needs no pivoting (and hence no per-lane branches)
+    static void invert(value_type (&m)[5][5]) {
+        for (std::size_t k = 0; k < 5u; ++k) {
+            const value_type pivot = value_type::broadcast(1) / m[k][k];
+            m[k][k] = value_type::broadcast(1);
+            for (std::size_t j = 0; j < 5u; ++j) {
+                m[k][j] *= pivot;
+            }
+            for (std::size_t i = 0; i < 5u; ++i) {
+                if (i == k) {
+                    continue;
+                }
+                const value_type factor = m[i][k];
+                m[i][k] = value_type::broadcast(0);
+                for (std::size_t j = 0; j < 5u; ++j) {
+                    m[i][j] -= factor * m[k][j];
+                }
+            }
+        }
+    }
+    /// @}
+
+    /// Configuration of the fitter
+    batched_fitter_config m_cfg;
+    /// Field along z
+    scalar_t m_bz;
+    /// The planes, in module order
+    std::vector<plane> m_planes;
+    /// Plane index of every module barcode
+    std::unordered_map<std::uint64_t, std::size_t> m_plane_index;
+
+};  // class batched_kalman_fitter
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,177 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace traccc::tutorial {
+
+/// Bounded lock-free multi-producer multi-consumer queue
+///
+/// A ring buffer of cells, each with a sequence number that tells producers
+/// and consumers whether it is free for the current lap (after Dmitry
+/// Vyukov's bounded MPMC queue). Producers and consumers claim positions
+/// with a compare-and-swap on their own counter, so neither side ever takes
+/// a lock.
+///
+/// @c push() blocks while the queue is full, which is what throttles a
+/// stage that runs ahead of the next one. @c pop() blocks while the queue
+/// is empty, until @c close() was called and all elements were taken.
+/// Closing the queue early, e.g. because its consumer failed, also releases
+/// the producers: @c push() then refuses new elements.
+///
+/// @tparam T The (movable) element type
+///
+template <typename T>
+class bounded_queue {
+
+    public:
+    /// Create a queue for at least @c capacity elements
+    explicit bounded_queue(std::size_t capacity)
+        : m_size(round_up(capacity)),
+          m_mask(m_size - 1u),
+          m_cells(std::make_unique<cell[]>(m_size)) {
+        for (std::size_t i = 0; i < m_size; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bounded_queue(const bounded_queue&) = delete;
+    bounded_queue& operator=(const bounded_queue&) = delete;
+
+    /// Number of elements the queue holds
+    std::size_t capacity() const { return m_size; }
+
+    /// Add an element, if the queue is not full
+    ///
+    /// @return @c false, with @c value unchanged, if the queue is full
+    ///
+    bool try_push(T& value) {
+        std::size_t pos = m_push_pos.load(std::memory_order_relaxed);
+        while (true) {
+            cell& c = m_cells[pos & m_mask];
+            const std::size_t seq = c.sequence.load(std::memory_order_acquire);
+            const auto diff =
+                static_cast<std::ptrdiff_t>(seq) -
+                static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_push_pos.compare_exchange_weak(
+                        pos, pos + 1u, std::memory_order_relaxed)) {
+                    c.value = std::move(value);
+                    c.sequence.store(pos + 1u, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_push_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Take an element, if the queue is not empty
+    std::optional<T> try_pop() {
+        std::size_t pos = m_pop_pos.load(std::memory_order_relaxed);
+        while (true) {
+            cell& c = m_cells[pos & m_mask];
+            const std::size_t seq = c.sequence.load(std::memory_order_acquire);
+            const auto diff =
+                static_cast<std::ptrdiff_t>(seq) -
+                static_cast<std::ptrdiff_t>(pos + 1u);
+            if (diff == 0) {
+                if (m_pop_pos.compare_exchange_weak(
+                        pos, pos + 1u, std::memory_order_relaxed)) {
+                    std::optional<T> result{std::move(c.value)};
+                    c.sequence.store(pos + m_size, std::memory_order_release);
+                    return result;
+                }
+            } else if (diff < 0) {
+                return std::nullopt;
+            } else {
+                pos = m_pop_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Add an element, waiting while the queue is full
+    ///
+    /// @return @c false, without adding @c value, if the queue is closed
+    ///
+    bool push(T value) {
+        for (unsigned int spins = 0;; ++spins) {
+            if (m_closed.load(std::memory_order_acquire)) {
+                return false;
+            }
+            if (try_push(value)) {
+                return true;
+            }
+            backoff(spins);
+        }
+    }
+
+    /// Take an element, waiting while the queue is empty
+    ///
+    /// @return The element, or nothing once the queue is closed and empty
+    ///
+    std::optional<T> pop() {
+        for (unsigned int spins = 0;; ++spins) {
+            // Read the flag first: elements pushed before close() are then
+            // found by the try_pop() below.
+            const bool closed = m_closed.load(std::memory_order_acquire);
+            if (auto value = try_pop()) {
+                return value;
+            }
+            if (closed) {
+                return std::nullopt;
+            }
+            backoff(spins);
+        }
+    }
+
+    /// Tell the consumers that no more elements will be pushed
+    void close() { m_closed.store(true, std::memory_order_release); }
+
+    private:
+    /// One element of the ring buffer
+    struct alignas(64) cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    /// Smallest power of two not below @c n (and at least 2)
+    static std::size_t round_up(std::size_t n) {
+        std::size_t result = 2u;
+        while (result < n) {
+            result *= 2u;
+        }
+        return result;
+    }
+
+    /// Wait a little before the next attempt: spin first, then yield
+    static void backoff(unsigned int spins) {
+        if (spins >= 64u) {
+            std::this_thread::yield();
+        }
+    }
+
+    const std::size_t m_size;
+    const std::size_t m_mask;
+    std::unique_ptr<cell[]> m_cells;
+    alignas(64) std::atomic<std::size_t> m_push_pos{0u};
+    alignas(64) std::atomic<std::size_t> m_pop_pos{0u};
+    alignas(64) std::atomic<bool> m_closed{false};
+
+};  // class bounded_queue
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,388 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// traccc include(s).
+#include "traccc/edm/silicon_cell_collection.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// POSIX include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace traccc::tutorial {
+
+namespace details {
+
+/// Element type of a column of the host cell collection
+template <typename column_t>
+using cell_column_value_t =
+    typename std::remove_cvref_t<column_t>::value_type;
+
+/// Element types of the cell columns, in the order of the SoA collection
+using cell_host = edm::silicon_cell_collection::host;
+using channel0_t =
+    cell_column_value_t<decltype(std::declval<cell_host&>().channel0())>;
+using channel1_t =
+    cell_column_value_t<decltype(std::declval<cell_host&>().channel1())>;
+using activation_t =
+    cell_column_value_t<decltype(std::declval<cell_host&>().activation())>;
+using cell_time_t =
+    cell_column_value_t<decltype(std::declval<cell_host&>().time())>;
+using module_index_t =
+    cell_column_value_t<decltype(std::declval<cell_host&>().module_index())>;
+
+/// Number of columns in a cell block
+inline constexpr std::size_t n_cell_columns = 5u;
+
+/// Size of the elements of every column
+inline constexpr std::array<std::uint32_t, n_cell_columns> cell_column_sizes{
+    sizeof(channel0_t), sizeof(channel1_t), sizeof(activation_t),
+    sizeof(cell_time_t), sizeof(module_index_t)};
+
+/// Alignment of the event blocks and of the columns inside them
+inline constexpr std::size_t cell_file_alignment = 64u;
+
+/// Round @c value up to the column alignment
+inline constexpr std::uint64_t align_up(std::uint64_t value) {
+    return (value + cell_file_alignment - 1u) & ~(cell_file_alignment - 1u);
+}
+
+/// Header at the start of a cell file
+struct cell_file_header {
+    /// File identifier
+    char magic[8];
+    /// Number of events in the file
+    std::uint64_t n_events;
+    /// Offset of the event index (one @c cell_block_entry per event)
+    std::uint64_t index_offset;
+    /// Element size of every column, to refuse files of another build
+    std::array<std::uint32_t, n_cell_columns> column_sizes;
+};
+
+/// Location of one event block in a cell file
+struct cell_block_entry {
+    /// Offset of the block in the file
+    std::uint64_t offset;
+    /// Number of cells in the event
+    std::uint64_t n_cells;
+};
+
+/// Magic bytes of a cell file
+inline constexpr char cell_file_magic[8] = {'T', 'U', 'T', 'C',
+                                            'E', 'L', 'L', '1'};
+
+/// Offsets of the columns inside an event block with @c n_cells cells
+inline std::array<std::uint64_t, n_cell_columns> cell_column_offsets(
+    std::uint64_t n_cells) {
+    std::array<std::uint64_t, n_cell_columns> result{};
+    std::uint64_t offset = 0;
+    for (std::size_t i = 0; i < n_cell_columns; ++i) {
+        result[i] = offset;
+        offset = align_up(offset + n_cells * cell_column_sizes[i]);
+    }
+    return result;
+}
+
+/// Size of an event block with @c n_cells cells, up to its last column
+inline std::uint64_t cell_block_size(std::uint64_t n_cells) {
+    return cell_column_offsets(n_cells).back() +
+           n_cells * cell_column_sizes.back();
+}
+
+/// Point one column view of an event at the data of a block
+template <typename column_view_t>
+void set_cell_column(column_view_t& column, unsigned int n,
+                     const std::byte* ptr) {
+    using pointer = typename column_view_t::pointer;
+    column = column_view_t{n, reinterpret_cast<pointer>(ptr)};
+}
+
+/// View of the cells of an event block at @c block
+inline edm::silicon_cell_collection::const_view cell_block_view(
+    const std::byte* block, std::uint64_t n_cells) {
+
+    const auto n = static_cast<unsigned int>(n_cells);
+    const auto offsets = cell_column_offsets(n_cells);
+    edm::silicon_cell_collection::const_view view{n};
+    set_cell_column(view.template get<0>(), n, block + offsets[0]);
+    set_cell_column(view.template get<1>(), n, block + offsets[1]);
+    set_cell_column(view.template get<2>(), n, block + offsets[2]);
+    set_cell_column(view.template get<3>(), n, block + offsets[3]);
+    set_cell_column(view.template get<4>(), n, block + offsets[4]);
+    return view;
+}
+
+/// Copy the cells of an event into a block of @c cell_block_size bytes
+inline void pack_cell_block(
+    const edm::silicon_cell_collection::const_view& cells, std::byte* block) {
+
+    const std::uint64_t n_cells =
+        edm::silicon_cell_collection::const_device(cells).size();
+    const auto offsets = cell_column_offsets(n_cells);
+    const auto copy_column = [&](std::size_t i, const auto& column) {
+        std::memcpy(block + offsets[i], column.ptr(),
+                    n_cells * cell_column_sizes[i]);
+    };
+    copy_column(0u, cells.template get<0>());
+    copy_column(1u, cells.template get<1>());
+    copy_column(2u, cells.template get<2>());
+    copy_column(3u, cells.template get<3>());
+    copy_column(4u, cells.template get<4>());
+}
+
+}  // namespace details
+
+/// Writer of columnar binary cell files
+///
+/// Every event is stored as one block of five contiguous, 64-byte aligned
+/// columns in the order and with the element types of
+/// @c edm::silicon_cell_collection, so that a reader can hand the columns to
+/// the algorithms without touching the data. An index of the event blocks is
+/// written at the end of the file by @c close().
+///
+class cell_file_writer {
+
+    public:
+    /// Create (or truncate) the file at @c path
+    explicit cell_file_writer(const std::string& path)
+        : m_out(path, std::ios::binary | std::ios::trunc) {
+        if (!m_out) {
+            throw std::runtime_error("Could not create " + path);
+        }
+        details::cell_file_header header{};
+        m_out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_offset = sizeof(header);
+    }
+
+    /// Finish the file, if that was not done explicitly
+    ~cell_file_writer() {
+        if (m_out.is_open()) {
+            try {
+                close();
+            } catch (...) {
+            }
+        }
+    }
+
+    /// Append one event
+    void write(const edm::silicon_cell_collection::host& cells) {
+
+        const std::uint64_t n_cells = cells.size();
+        pad_to(details::align_up(m_offset));
+        m_index.push_back({m_offset, n_cells});
+
+        const auto offsets = details::cell_column_offsets(n_cells);
+        const std::uint64_t block_start = m_offset;
+        const auto write_column = [&](std::size_t i, const auto& column) {
+            pad_to(block_start + offsets[i]);
+            write_bytes(column.data(), n_cells * details::cell_column_sizes[i]);
+        };
+        write_column(0u, cells.channel0());
+        write_column(1u, cells.channel1());
+        write_column(2u, cells.activation());
+        write_column(3u, cells.time());
+        write_column(4u, cells.module_index());
+    }
+
+    /// Write the event index and the final header
+    void close() {
+
+        pad_to(details::align_up(m_offset));
+        details::cell_file_header header{};
+        std::memcpy(header.magic, details::cell_file_magic,
+                    sizeof(header.magic));
+        header.n_events = m_index.size();
+        header.index_offset = m_offset;
+        header.column_sizes = details::cell_column_sizes;
+        write_bytes(m_index.data(),
+                    m_index.size() * sizeof(details::cell_block_entry));
+
+        m_out.seekp(0);
+        m_out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_out.close();
+        if (m_out.fail()) {
+            throw std::runtime_error("Could not write the cell file");
+        }
+    }
+
+    private:
+    void write_bytes(const void* ptr, std::uint64_t size) {
+        m_out.write(static_cast<const char*>(ptr),
+                    static_cast<std::streamsize>(size));
+        m_offset += size;
+    }
+    void pad_to(std::uint64_t offset) {
+        static constexpr char zeros[details::cell_file_alignment] = {};
+        write_bytes(zeros, offset - m_offset);
+    }
+
+    /// The output file
+    std::ofstream m_out;
+    /// Current write offset
+    std::uint64_t m_offset = 0;
+    /// Index of the written event blocks
+    std::vector<details::cell_block_entry> m_index;
+
+};  // class cell_file_writer
+
+/// Streaming, zero-copy reader of columnar binary cell files
+///
+/// The file is memory-mapped, and every event is exposed as a
+/// @c edm::silicon_cell_collection::const_view whose columns point straight
+/// into the mapping, so clusterization reads the cells directly from the
+/// page cache. Accessing an event asks the kernel to read the next
+/// @c read_ahead event blocks asynchronously, which keeps sequential and
+/// event-parallel consumers from stalling on I/O.
+///
+/// The reader is immutable after construction, so it can be shared by any
+/// number of threads.
+///
+class cell_file_reader {
+
+    public:
+    /// Map the cell file at @c path
+    explicit cell_file_reader(const std::string& path,
+                              std::size_t read_ahead = 2u)
+        : m_read_ahead(read_ahead) {
+
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open " + path);
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Could not stat " + path);
+        }
+        m_size = static_cast<std::size_t>(st.st_size);
+        void* ptr = (m_size >= sizeof(details::cell_file_header))
+                        ? ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0)
+                        : MAP_FAILED;
+        ::close(fd);
+        if (ptr == MAP_FAILED) {
+            throw std::runtime_error("Could not map " + path);
+        }
+        m_data = static_cast<const std::byte*>(ptr);
+
+        const auto& header =
+            *reinterpret_cast<const details::cell_file_header*>(m_data);
+        if (std::memcmp(header.magic, details::cell_file_magic,
+                        sizeof(header.magic)) != 0 ||
+            header.column_sizes != details::cell_column_sizes) {
+            ::munmap(ptr, m_size);
+            throw std::runtime_error(path + " is not a compatible cell file");
+        }
+        m_n_events = header.n_events;
+        m_index = reinterpret_cast<const details::cell_block_entry*>(
+            m_data + header.index_offset);
+        if (!valid(header)) {
+            ::munmap(ptr, m_size);
+            throw std::runtime_error(path + " is truncated or corrupt");
+        }
+    }
+
+    /// Unmap the file; views handed out must not be used afterwards
+    ~cell_file_reader() {
+        ::munmap(const_cast<std::byte*>(m_data), m_size);
+    }
+
+    cell_file_reader(const cell_file_reader&) = delete;
+    cell_file_reader& operator=(const cell_file_reader&) = delete;
+
+    /// Number of events in the file
+    std::size_t size() const { return m_n_events; }
+
+    /// Number of cells in event @c event
+    std::size_t n_cells(std::size_t event) const {
+        return m_index[event].n_cells;
+    }
+
+    /// View of the cells of event @c event, pointing into the mapping
+    edm::silicon_cell_collection::const_view event(std::size_t event) const {
+
+        prefetch(event + 1u, event + 1u + m_read_ahead);
+
+        const auto& entry = m_index[event];
+        return details::cell_block_view(m_data + entry.offset, entry.n_cells);
+    }
+
+    private:
+    /// Whether the index and every event block lie inside the file
+    ///
+    /// The comparisons are written so that corrupt offsets and sizes can
+    /// not overflow them.
+    ///
+    bool valid(const details::cell_file_header& header) const {
+
+        using entry_type = details::cell_block_entry;
+        if (header.index_offset > m_size ||
+            header.index_offset % alignof(entry_type) != 0u ||
+            header.n_events >
+                (m_size - header.index_offset) / sizeof(entry_type)) {
+            return false;
+        }
+        for (std::size_t i = 0; i < m_n_events; ++i) {
+            const entry_type& entry = m_index[i];
+            if (entry.offset > m_size || entry.n_cells > m_size ||
+                entry.n_cells > std::numeric_limits<unsigned int>::max() ||
+                details::cell_block_size(entry.n_cells) >
+                    m_size - entry.offset) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Ask the kernel to page in the blocks of events [begin, end)
+    void prefetch(std::size_t begin, std::size_t end) const {
+        if (begin >= m_n_events) {
+            return;
+        }
+        end = std::min<std::size_t>(end, m_n_events);
+        const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::size_t first = m_index[begin].offset & ~(page - 1u);
+        const std::size_t last =
+            m_index[end - 1u].offset +
+            details::cell_block_size(m_index[end - 1u].n_cells);
+        ::madvise(const_cast<std::byte*>(m_data) + first, last - first,
+                  MADV_WILLNEED);
+    }
+
+    /// Number of events to read ahead
+    std::size_t m_read_ahead;
+    /// The mapped file
+    const std::byte* m_data = nullptr;
+    /// Size of the mapped file
+    std::size_t m_size = 0;
+    /// Number of events in the file
+    std::size_t m_n_events = 0;
+    /// Index of the event blocks
+    const details::cell_block_entry* m_index = nullptr;
+
+};  // class cell_file_reader
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,278 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <utility>
+
+// POSIX include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace traccc::tutorial {
+
+/// Default virtual address at which detector snapshots are mapped
+inline constexpr std::uintptr_t default_snapshot_address = 0x200000000000ull;
+
+namespace details {
+
+/// Bump allocator over the address range of a snapshot image
+///
+/// The resource object itself lives at the start of the image, so the
+/// allocator pointers stored inside the detector's containers stay valid
+/// when the image is mapped back at the same address.
+///
+class snapshot_memory_resource : public vecmem::memory_resource {
+
+    public:
+    snapshot_memory_resource(std::byte* begin, std::byte* end,
+                             std::byte* cursor)
+        : m_begin(begin), m_end(end), m_cursor(cursor) {}
+
+    /// Number of bytes used from the start of the image
+    std::size_t used() const {
+        return static_cast<std::size_t>(m_cursor - m_begin);
+    }
+
+    private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        const auto cursor = reinterpret_cast<std::uintptr_t>(m_cursor);
+        auto* ptr = reinterpret_cast<std::byte*>((cursor + alignment - 1u) &
+                                                 ~(alignment - 1u));
+        if (ptr + bytes > m_end) {
+            throw std::bad_alloc();
+        }
+        m_cursor = ptr + bytes;
+        return ptr;
+    }
+    // The image is never freed piece by piece.
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::byte* m_begin;
+    std::byte* m_end;
+    std::byte* m_cursor;
+
+};  // class snapshot_memory_resource
+
+/// Header at the start of a snapshot file
+struct snapshot_header {
+    /// File identifier
+    char magic[8];
+    /// Hash of the detector type name, to refuse foreign snapshots
+    std::uint64_t type_hash;
+    /// Size of the detector type
+    std::uint64_t type_size;
+    /// Address the image has to be mapped at
+    std::uint64_t base_address;
+    /// Size of the image
+    std::uint64_t image_size;
+    /// Offset of the detector object in the image
+    std::uint64_t detector_offset;
+};
+
+/// Magic bytes of a snapshot file
+inline constexpr char snapshot_magic[8] = {'T', 'U', 'T', 'D',
+                                           'S', 'N', 'P', '1'};
+/// Space reserved for the header, so that the image is page-aligned in the
+/// file even on systems with 64 kB pages
+inline constexpr std::size_t snapshot_header_space = 64u * 1024u;
+
+/// Hash of the name of a type
+template <typename T>
+std::uint64_t type_hash() {
+    return std::hash<std::string_view>{}(typeid(T).name());
+}
+
+/// Map @c size bytes at exactly @c address, or throw
+inline void* map_fixed(std::uintptr_t address, std::size_t size, int prot,
+                       int flags, int fd, off_t offset) {
+    void* ptr = ::mmap(reinterpret_cast<void*>(address), size, prot,
+                       flags | MAP_FIXED_NOREPLACE, fd, offset);
+    if (ptr == MAP_FAILED) {
+        throw std::runtime_error("Could not map the detector snapshot at " +
+                                 std::to_string(address) + ": " +
+                                 std::strerror(errno));
+    }
+    if (reinterpret_cast<std::uintptr_t>(ptr) != address) {
+        // Kernels before 4.17 treat the address as a hint only.
+        ::munmap(ptr, size);
+        throw std::runtime_error(
+            "Could not map the detector snapshot at its fixed address");
+    }
+    return ptr;
+}
+
+}  // namespace details
+
+/// Binary, memory-mappable snapshot of a host detector
+///
+/// A snapshot is a byte-for-byte image of a detector object together with
+/// all of its container payloads, built in an address range reserved at a
+/// fixed virtual address. Loading it maps the file back at that address, so
+/// every pointer in the image is valid again without any parsing, copying or
+/// pointer fix-up, and pages are only read from disk when they are touched.
+///
+/// Snapshots are specific to the binary layout of the detector type: they
+/// have to be written and read by executables built against the same
+/// traccc/detray version and configuration. This is checked (by type name
+/// and size) when loading.
+///
+template <typename detector_t>
+class detector_snapshot {
+
+    public:
+    /// Build a detector inside a snapshot image and write it to a file
+    ///
+    /// @param path     The file to write
+    /// @param build    Callable building the detector from the memory
+    ///                 resource it receives, e.g. with
+    ///                 @c detray::io::read_detector
+    /// @param capacity Address range to reserve for the image
+    /// @param address  Virtual address of the image
+    ///
+    template <typename build_t>
+    static std::size_t write(const std::string& path, build_t&& build,
+                             std::size_t capacity = std::size_t{1} << 32,
+                             std::uintptr_t address =
+                                 default_snapshot_address) {
+
+        void* base = details::map_fixed(
+            address, capacity, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        auto* begin = static_cast<std::byte*>(base);
+
+        // The resource is the first object of the image, the detector is
+        // moved into the image once it has been built.
+        auto* resource = new (begin) details::snapshot_memory_resource(
+            begin, begin + capacity,
+            begin + sizeof(details::snapshot_memory_resource));
+        void* det_ptr = nullptr;
+        {
+            detector_t det = build(*resource);
+            det_ptr = resource->allocate(sizeof(detector_t),
+                                         alignof(detector_t));
+            new (det_ptr) detector_t(std::move(det));
+        }
+
+        details::snapshot_header header{};
+        std::memcpy(header.magic, details::snapshot_magic,
+                    sizeof(header.magic));
+        header.type_hash = details::type_hash<detector_t>();
+        header.type_size = sizeof(detector_t);
+        header.base_address = address;
+        header.image_size = resource->used();
+        header.detector_offset = static_cast<std::uint64_t>(
+            static_cast<std::byte*>(det_ptr) - begin);
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        std::string header_space(details::snapshot_header_space, '\0');
+        std::memcpy(header_space.data(), &header, sizeof(header));
+        out.write(header_space.data(),
+                  static_cast<std::streamsize>(header_space.size()));
+        out.write(reinterpret_cast<const char*>(begin),
+                  static_cast<std::streamsize>(header.image_size));
+        if (!out) {
+            ::munmap(base, capacity);
+            throw std::runtime_error("Could not write " + path);
+        }
+
+        // The image is released without destroying the detector: all of
+        // its memory belongs to the mapping.
+        const std::size_t size = header.image_size;
+        ::munmap(base, capacity);
+        return size;
+    }
+
+    /// Map a snapshot file written by @c write
+    explicit detector_snapshot(const std::string& path) {
+
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open " + path);
+        }
+        details::snapshot_header header{};
+        if (::pread(fd, &header, sizeof(header), 0) !=
+                static_cast<ssize_t>(sizeof(header)) ||
+            std::memcmp(header.magic, details::snapshot_magic,
+                        sizeof(header.magic)) != 0) {
+            ::close(fd);
+            throw std::runtime_error(path + " is not a detector snapshot");
+        }
+        if (header.type_hash != details::type_hash<detector_t>() ||
+            header.type_size != sizeof(detector_t)) {
+            ::close(fd);
+            throw std::runtime_error(
+                path + " was written for a different detector type/build");
+        }
+
+        // Private mapping: the detector is never modified, but the resource
+        // object is re-constructed in place (to set up its vtable pointer).
+        try {
+            m_base = details::map_fixed(
+                header.base_address, header.image_size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE, fd, details::snapshot_header_space);
+        } catch (...) {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+        m_size = header.image_size;
+
+        auto* begin = static_cast<std::byte*>(m_base);
+        new (begin) details::snapshot_memory_resource(
+            begin, begin + m_size, begin + m_size);
+        m_detector = std::launder(
+            reinterpret_cast<const detector_t*>(begin + header.detector_offset));
+    }
+
+    /// Unmap the snapshot; the detector must not be used afterwards
+    ~detector_snapshot() {
+        if (m_base != nullptr) {
+            ::munmap(m_base, m_size);
+        }
+    }
+
+    detector_snapshot(const detector_snapshot&) = delete;
+    detector_snapshot& operator=(const detector_snapshot&) = delete;
+
+    /// The detector stored in the snapshot
+    const detector_t& detector() const { return *m_detector; }
+
+    /// Size of the mapped image
+    std::size_t size() const { return m_size; }
+
+    private:
+    /// Start of the mapping
+    void* m_base = nullptr;
+    /// Size of the mapping
+    std::size_t m_size = 0;
+    /// The detector inside the mapping
+    const detector_t* m_detector = nullptr;
+
+};  // class detector_snapshot
+
+}  // namespace traccc::tutorial
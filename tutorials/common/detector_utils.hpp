@@ -0,0 +1,145 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/geometry/detector.hpp"
+#include "traccc/geometry/silicon_detector_description.hpp"
+
+// detray include(s).
+#include "detray/core/detector.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <array>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Directory holding the telescope geometry files of the tutorial
+inline std::string geometry_directory() {
+    std::string file{__FILE__};
+    std::string dir{file.substr(0, file.rfind("/"))};
+    return dir + "/../../geometry";
+}
+
+/// Reader configuration for the telescope geometry written by
+/// @c write_detector
+inline detray::io::detector_reader_config telescope_reader_config() {
+
+    detray::io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file(geometry_directory() +
+                        "/telescope_detector_geometry.json");
+    reader_cfg.add_file(geometry_directory() +
+                        "/telescope_detector_homogeneous_material.json");
+    return reader_cfg;
+}
+
+/// Read the telescope geometry written by @c write_detector
+inline auto read_telescope_detector(vecmem::memory_resource& mr) {
+
+    return detray::io::read_detector<traccc::default_detector::host>(
+        mr, telescope_reader_config());
+}
+
+/// Placement of one sensitive module of the detector
+struct module_placement {
+    /// Barcode of the module surface
+    detray::geometry::barcode barcode;
+    /// Local-to-global transform of the module surface
+    traccc::default_detector::host::transform3_type transform;
+    /// Half-lengths of the module in its local x and y
+    std::array<scalar, 2> half_lengths;
+};
+
+/// Mask visitor returning the half-lengths of a rectangular module
+///
+/// Modules of any other shape are treated as unbounded.
+///
+struct rectangle_half_lengths {
+    template <typename mask_group_t, typename index_t>
+    std::array<scalar, 2> operator()(const mask_group_t& masks,
+                                     const index_t& index) const {
+        using mask_type = typename mask_group_t::value_type;
+        if constexpr (std::is_same_v<typename mask_type::shape,
+                                     detray::rectangle2D>) {
+            const auto& mask = masks[index];
+            return {static_cast<scalar>(mask[detray::rectangle2D::e_half_x]),
+                    static_cast<scalar>(mask[detray::rectangle2D::e_half_y])};
+        } else {
+            return {std::numeric_limits<scalar>::infinity(),
+                    std::numeric_limits<scalar>::infinity()};
+        }
+    }
+};
+
+/// Collect the sensitive modules of a detector, in surface order
+template <typename detector_t>
+std::vector<module_placement> sensitive_modules(const detector_t& det) {
+
+    std::vector<module_placement> result;
+    for (const auto& sf_desc : det.surfaces()) {
+        if (!sf_desc.is_sensitive()) {
+            continue;
+        }
+        const detray::tracking_surface sf{det, sf_desc};
+        result.push_back(
+            {sf_desc.barcode(), sf.transform({}),
+             sf.template visit_mask<rectangle_half_lengths>()});
+    }
+    return result;
+}
+
+/// Readout segmentation used for every pixel module
+struct pixel_readout {
+    /// Pitch of the cells in the local x-axis
+    scalar pitch_x = 50.f * unit<scalar>::um;
+    /// Pitch of the cells in the local y-axis
+    scalar pitch_y = 50.f * unit<scalar>::um;
+    /// Local x position of the lower edge of the first cell
+    scalar reference_x = -10000.f * unit<scalar>::mm;
+    /// Local y position of the lower edge of the first cell
+    scalar reference_y = -10000.f * unit<scalar>::mm;
+    /// Number of cells in the local x-axis (covering the 20 m wide modules)
+    unsigned int n_cells_x = 400000u;
+    /// Number of cells in the local y-axis
+    unsigned int n_cells_y = 400000u;
+};
+
+/// Build the digitization description of the sensitive modules
+///
+/// The module index of a cell is the position of its module in
+/// @c modules, which is how the event generators fill @c module_index().
+///
+inline traccc::silicon_detector_description::host make_detector_description(
+    const std::vector<module_placement>& modules, vecmem::memory_resource& mr,
+    const pixel_readout& readout = {}) {
+
+    traccc::silicon_detector_description::host dd{mr};
+    dd.resize(static_cast<unsigned int>(modules.size()));
+    for (std::size_t i = 0; i < modules.size(); ++i) {
+        dd.reference_x()[i] = readout.reference_x;
+        dd.reference_y()[i] = readout.reference_y;
+        dd.pitch_x()[i] = readout.pitch_x;
+        dd.pitch_y()[i] = readout.pitch_y;
+        dd.dimensions()[i] = 2;
+        dd.geometry_id()[i] = modules[i].barcode;
+    }
+    return dd;
+}
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,340 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/detector_utils.hpp"
+#include "common/options.hpp"
+#include "common/telescope_navigator.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of the synthetic event generator
+struct generator_config {
+
+    /// Number of particles per event
+    std::size_t n_particles = 10u;
+
+    /// @name Particle gun
+    /// @{
+    /// Momentum range, sampled uniformly
+    scalar p_min = 1.f * unit<scalar>::GeV;
+    scalar p_max = 10.f * unit<scalar>::GeV;
+    /// Azimuthal angle range around the telescope axis
+    scalar phi_min = -0.1f;
+    scalar phi_max = 0.1f;
+    /// Polar angle range around the telescope axis
+    scalar theta_min = constant<scalar>::pi_2 - 0.1f;
+    scalar theta_max = constant<scalar>::pi_2 + 0.1f;
+    /// Mean position of the production vertex
+    point3 vertex{-50.f * unit<scalar>::mm, 0.f, 0.f};
+    /// Gaussian spread of the production vertex in every direction
+    scalar vertex_sigma = 10.f * unit<scalar>::um;
+    /// Charge of the particles; both signs are generated if @c false
+    bool fixed_charge = true;
+    scalar charge = -1.f * unit<scalar>::e;
+    /// @}
+
+    /// @name Digitization
+    /// @{
+    /// Pixels with their centre closer than this to the hit fire as well
+    scalar cluster_radius = 0.f;
+    /// Noise cells per module and event
+    std::size_t n_noise_cells = 0u;
+    /// Noise cells are placed uniformly within this distance of the origin
+    scalar noise_half_width = 200.f * unit<scalar>::mm;
+    /// @}
+
+    /// Seed of the random number generation
+    std::uint64_t seed = 42u;
+
+};  // struct generator_config
+
+/// Generator configuration, with the values given on the command line
+///
+/// Recognises @c --particles, @c --p-min and @c --p-max (in GeV),
+/// @c --noise, @c --cluster-radius (in mm) and @c --seed.
+///
+inline generator_config make_generator_config(const options& opts) {
+    generator_config cfg;
+    cfg.n_particles = opts.get("particles", cfg.n_particles);
+    cfg.p_min =
+        opts.get("p-min", cfg.p_min / unit<scalar>::GeV) * unit<scalar>::GeV;
+    cfg.p_max =
+        opts.get("p-max", cfg.p_max / unit<scalar>::GeV) * unit<scalar>::GeV;
+    cfg.n_noise_cells = opts.get("noise", cfg.n_noise_cells);
+    cfg.cluster_radius =
+        opts.get("cluster-radius", cfg.cluster_radius / unit<scalar>::mm) *
+        unit<scalar>::mm;
+    cfg.seed = opts.get("seed", cfg.seed);
+    return cfg;
+}
+
+/// Truth information of a generated particle
+struct truth_particle {
+    point3 vertex;
+    vector3 momentum;
+    scalar charge;
+};
+
+/// Truth information of a particle crossing a module
+struct truth_hit {
+    /// Index of the particle in @c generated_event::particles
+    std::size_t particle;
+    /// Index of the module in the generator's module list
+    unsigned int module;
+    /// Local position on the module
+    point2 local;
+    /// Global position
+    point3 global;
+};
+
+/// One generated event
+struct generated_event {
+    /// Digitized cells, ordered by module and then by channel
+    edm::silicon_cell_collection::host cells;
+    /// Truth measurements, one per entry in @c hits
+    measurement_collection_types::host measurements;
+    /// The generated particles
+    std::vector<truth_particle> particles;
+    /// The module crossings of the generated particles
+    std::vector<truth_hit> hits;
+};
+
+/// Synthetic event generator for the telescope geometry
+///
+/// Particles are shot from a common (smeared) vertex along the telescope
+/// axis, propagated on helices through the magnetic field to the modules
+/// with @c telescope_navigator, and digitized into pixel cells. The
+/// navigator crosses the helix with the planes in closed form, instead of
+/// stepping along @c detray::detail::helix, and @c BM_telescope_navigation
+/// checks its crossings against detray's propagation. Every event is
+/// generated from its own random stream, so events can be produced in any
+/// order and on any thread with identical results.
+///
+class event_generator {
+
+    public:
+    /// Construct the generator
+    ///
+    /// @param cfg     The generator configuration
+    /// @param modules The sensitive modules, in module index order
+    /// @param readout The pixel segmentation of the modules
+    /// @param B       The (constant) magnetic field
+    ///
+    event_generator(const generator_config& cfg,
+                    const std::vector<module_placement>& modules,
+                    const pixel_readout& readout, const vector3& B)
+        : m_cfg(cfg),
+          m_modules(modules),
+          m_readout(readout),
+          m_navigator(modules, B, false) {}
+
+    /// Generate event number @c event
+    generated_event operator()(std::size_t event,
+                               vecmem::memory_resource& mr) const {
+
+        std::seed_seq seq{static_cast<std::uint32_t>(m_cfg.seed),
+                          static_cast<std::uint32_t>(m_cfg.seed >> 32),
+                          static_cast<std::uint32_t>(event),
+                          static_cast<std::uint32_t>(event >> 32)};
+        std::mt19937_64 rng{seq};
+        // Draw in double precision, so that float and double builds of the
+        // tutorial generate the same events.
+        std::uniform_real_distribution<double> uniform_dist{0., 1.};
+        std::normal_distribution<double> gauss_dist{0., 1.};
+        const auto uniform = [&uniform_dist](std::mt19937_64& engine) {
+            return static_cast<scalar>(uniform_dist(engine));
+        };
+        const auto gauss = [&gauss_dist](std::mt19937_64& engine) {
+            return static_cast<scalar>(gauss_dist(engine));
+        };
+
+        generated_event result{edm::silicon_cell_collection::host{mr},
+                               measurement_collection_types::host{&mr},
+                               {},
+                               {}};
+
+        // Cells as (module, channel1, channel0, activation)
+        std::vector<std::tuple<unsigned int, unsigned int, unsigned int,
+                               scalar>>
+            cells;
+
+        /*****************************
+         * Particles
+         *****************************/
+
+        for (std::size_t i = 0; i < m_cfg.n_particles; ++i) {
+
+            const scalar p =
+                m_cfg.p_min + (m_cfg.p_max - m_cfg.p_min) * uniform(rng);
+            const scalar phi =
+                m_cfg.phi_min + (m_cfg.phi_max - m_cfg.phi_min) * uniform(rng);
+            const scalar theta = m_cfg.theta_min +
+                                 (m_cfg.theta_max - m_cfg.theta_min) *
+                                     uniform(rng);
+            const scalar q = (m_cfg.fixed_charge || uniform(rng) < 0.5f)
+                                 ? m_cfg.charge
+                                 : -m_cfg.charge;
+            const vector3 dir{std::cos(phi) * std::sin(theta),
+                              std::sin(phi) * std::sin(theta),
+                              std::cos(theta)};
+            const point3 vertex{
+                m_cfg.vertex[0] + m_cfg.vertex_sigma * gauss(rng),
+                m_cfg.vertex[1] + m_cfg.vertex_sigma * gauss(rng),
+                m_cfg.vertex[2] + m_cfg.vertex_sigma * gauss(rng)};
+
+            result.particles.push_back({vertex, p * dir, q});
+
+            m_navigator.propagate(
+                vertex, dir, q / p, [&](const plane_crossing& crossing) {
+                    const point3 local =
+                        m_modules[crossing.module].transform.point_to_local(
+                            crossing.position);
+                    const point2 local2{local[0], local[1]};
+                    if (digitize(crossing.module, local2, cells)) {
+                        result.hits.push_back(
+                            {i, crossing.module, local2, crossing.position});
+                    }
+                    return true;
+                });
+        }
+
+        /*****************************
+         * Noise
+         *****************************/
+
+        for (unsigned int m = 0; m < m_modules.size(); ++m) {
+            for (std::size_t i = 0; i < m_cfg.n_noise_cells; ++i) {
+                const point2 local{
+                    m_cfg.noise_half_width * (2.f * uniform(rng) - 1.f),
+                    m_cfg.noise_half_width * (2.f * uniform(rng) - 1.f)};
+                digitize(m, local, cells, 0.5f);
+            }
+        }
+
+        /*****************************
+         * Output collections
+         *****************************/
+
+        // Merge the pixels fired more than once.
+        std::sort(cells.begin(), cells.end());
+        std::vector<std::tuple<unsigned int, unsigned int, unsigned int,
+                               scalar>>
+            merged;
+        merged.reserve(cells.size());
+        for (const auto& c : cells) {
+            if (!merged.empty() &&
+                std::get<0>(merged.back()) == std::get<0>(c) &&
+                std::get<1>(merged.back()) == std::get<1>(c) &&
+                std::get<2>(merged.back()) == std::get<2>(c)) {
+                std::get<3>(merged.back()) += std::get<3>(c);
+            } else {
+                merged.push_back(c);
+            }
+        }
+
+        result.cells.resize(static_cast<unsigned int>(merged.size()));
+        for (std::size_t i = 0; i < merged.size(); ++i) {
+            result.cells.module_index()[i] = std::get<0>(merged[i]);
+            result.cells.channel1()[i] = std::get<1>(merged[i]);
+            result.cells.channel0()[i] = std::get<2>(merged[i]);
+            result.cells.activation()[i] = std::get<3>(merged[i]);
+            result.cells.time()[i] = 0.f;
+        }
+
+        result.measurements.reserve(result.hits.size());
+        const scalar var_x = m_readout.pitch_x * m_readout.pitch_x / 12.f;
+        const scalar var_y = m_readout.pitch_y * m_readout.pitch_y / 12.f;
+        for (std::size_t i = 0; i < result.hits.size(); ++i) {
+            measurement meas;
+            meas.local = result.hits[i].local;
+            meas.variance = {var_x, var_y};
+            meas.surface_link = m_modules[result.hits[i].module].barcode;
+            meas.measurement_id = static_cast<unsigned int>(i);
+            result.measurements.push_back(meas);
+        }
+
+        return result;
+    }
+
+    private:
+    /// Turn a local position on module @c m into fired pixels
+    ///
+    /// @return @c false if the position is outside of the readout; cells of
+    ///         a cluster outside of it do not fire
+    ///
+    template <typename cell_vector_t>
+    bool digitize(unsigned int m, const point2& local, cell_vector_t& cells,
+                  scalar activation = 1.f) const {
+
+        const scalar u = (local[0] - m_readout.reference_x) / m_readout.pitch_x;
+        const scalar v = (local[1] - m_readout.reference_y) / m_readout.pitch_y;
+        if (!(u >= 0.f && v >= 0.f &&
+              u < static_cast<scalar>(m_readout.n_cells_x) &&
+              v < static_cast<scalar>(m_readout.n_cells_y))) {
+            return false;
+        }
+        const auto c0 = static_cast<int>(u);
+        const auto c1 = static_cast<int>(v);
+        const int reach_x =
+            static_cast<int>(std::ceil(m_cfg.cluster_radius / m_readout.pitch_x));
+        const int reach_y =
+            static_cast<int>(std::ceil(m_cfg.cluster_radius / m_readout.pitch_y));
+
+        const int last_x = static_cast<int>(m_readout.n_cells_x) - 1;
+        const int last_y = static_cast<int>(m_readout.n_cells_y) - 1;
+        for (int j = std::max(c1 - reach_y, 0);
+             j <= std::min(c1 + reach_y, last_y); ++j) {
+            for (int i = std::max(c0 - reach_x, 0);
+                 i <= std::min(c0 + reach_x, last_x); ++i) {
+                const scalar dx = (static_cast<scalar>(i) + 0.5f - u) *
+                                  m_readout.pitch_x;
+                const scalar dy = (static_cast<scalar>(j) + 0.5f - v) *
+                                  m_readout.pitch_y;
+                if ((i != c0 || j != c1) &&
+                    dx * dx + dy * dy >
+                        m_cfg.cluster_radius * m_cfg.cluster_radius) {
+                    continue;
+                }
+                cells.emplace_back(m, static_cast<unsigned int>(j),
+                                   static_cast<unsigned int>(i), activation);
+            }
+        }
+        return true;
+    }
+
+    /// Configuration of the generator
+    generator_config m_cfg;
+    /// The sensitive modules
+    const std::vector<module_placement>& m_modules;
+    /// Pixel segmentation of the modules
+    pixel_readout m_readout;
+    /// Propagation of the particles through the modules; not counted by the
+    /// instrumentation, which is about the reconstruction
+    telescope_navigator m_navigator;
+
+};  // class event_generator
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,427 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/cell_file.hpp"
+#include "common/track_state_file.hpp"
+
+// traccc include(s).
+#include "traccc/edm/silicon_cell_collection.hpp"
+
+// System include(s).
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// POSIX include(s).
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace traccc::tutorial {
+
+/// Kind of a request sent to the reconstruction daemon
+enum class request_type : std::uint32_t {
+    /// Reconstruct the events of the request
+    reconstruct = 1,
+    /// Stop the daemon
+    shutdown = 2
+};
+
+namespace details {
+
+/// Header of a request
+struct request_header {
+    /// Protocol identifier
+    char magic[8];
+    /// @c request_type of the request
+    std::uint32_t type;
+    /// Number of events that follow
+    std::uint32_t n_events;
+    /// Element size of every cell column, to refuse clients of another build
+    std::array<std::uint32_t, n_cell_columns> column_sizes;
+};
+
+/// Header of every event of a request, followed by its cell block
+struct request_event_header {
+    /// Number of the event
+    std::uint64_t event;
+    /// Number of cells in the event
+    std::uint64_t n_cells;
+};
+
+/// Header of the answer to one event, followed by its track columns
+struct response_header {
+    /// Number of the event
+    std::uint64_t event;
+    /// Number of tracks and track states in the columns
+    std::uint64_t n_tracks;
+    std::uint64_t n_states;
+    /// @c track_parametrization of the tracks
+    std::uint32_t parametrization;
+    /// Whether the event was reconstructed
+    std::uint32_t ok;
+    /// Time the daemon spent reconstructing the event, in seconds
+    double reconstruction_time;
+};
+
+/// Magic bytes of a request
+inline constexpr char request_magic[8] = {'T', 'U', 'T', 'R',
+                                          'E', 'Q', 'S', '1'};
+
+/// @name Largest sizes accepted from the other side, so that a broken peer
+///       can not make the receiver allocate without bounds
+/// @{
+inline constexpr std::uint64_t max_events_per_request = 1u << 16;
+inline constexpr std::uint64_t max_cells_per_event = 1u << 24;
+inline constexpr std::uint64_t max_tracks_per_event = 1u << 20;
+inline constexpr std::uint64_t max_states_per_event = 1u << 24;
+/// @}
+
+}  // namespace details
+
+/// A connected Unix domain stream socket
+///
+/// Messages are sent and received as a whole: @c send() and @c receive()
+/// loop until all bytes are transferred. The socket is closed on
+/// destruction.
+///
+class event_socket {
+
+    public:
+    /// Take ownership of a connected socket
+    explicit event_socket(int fd) : m_fd(fd) {}
+
+    /// Connect to the daemon listening at @c path
+    static event_socket connect(const std::string& path) {
+        event_socket result(::socket(AF_UNIX, SOCK_STREAM, 0));
+        const sockaddr_un address = make_address(path);
+        if (result.m_fd < 0 ||
+            ::connect(result.m_fd,
+                      reinterpret_cast<const sockaddr*>(&address),
+                      sizeof(address)) != 0) {
+            throw std::runtime_error("Could not connect to " + path + ": " +
+                                     std::strerror(errno));
+        }
+        return result;
+    }
+
+    ~event_socket() {
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+    }
+
+    event_socket(const event_socket&) = delete;
+    event_socket& operator=(const event_socket&) = delete;
+    event_socket(event_socket&& other) noexcept
+        : m_fd(std::exchange(other.m_fd, -1)) {}
+    event_socket& operator=(event_socket&& other) noexcept {
+        std::swap(m_fd, other.m_fd);
+        return *this;
+    }
+
+    /// Send @c size bytes
+    void send(const void* ptr, std::size_t size) {
+        const auto* bytes = static_cast<const std::byte*>(ptr);
+        while (size > 0u) {
+            // No SIGPIPE if the other side went away; the error is thrown.
+            const ::ssize_t n = ::send(m_fd, bytes, size, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                throw std::runtime_error(std::string("Could not send: ") +
+                                         std::strerror(errno));
+            }
+            bytes += n;
+            size -= static_cast<std::size_t>(n);
+        }
+    }
+
+    /// Receive exactly @c size bytes
+    ///
+    /// @return @c false if the other side closed the connection before the
+    ///         first byte
+    ///
+    bool receive(void* ptr, std::size_t size) {
+        auto* bytes = static_cast<std::byte*>(ptr);
+        std::size_t received = 0;
+        while (received < size) {
+            const ::ssize_t n =
+                ::recv(m_fd, bytes + received, size - received, 0);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n == 0 && received == 0u) {
+                return false;
+            }
+            if (n <= 0) {
+                throw std::runtime_error("Connection closed mid-message");
+            }
+            received += static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    /// Address of the socket file at @c path
+    static sockaddr_un make_address(const std::string& path) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::invalid_argument("Socket path too long: " + path);
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1u);
+        return address;
+    }
+
+    private:
+    /// The socket
+    int m_fd;
+
+};  // class event_socket
+
+/// A listening Unix domain socket, removed again on destruction
+class event_socket_listener {
+
+    public:
+    /// Listen at @c path, replacing a stale socket file
+    explicit event_socket_listener(const std::string& path) : m_path(path) {
+        ::unlink(path.c_str());
+        m_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        const sockaddr_un address = event_socket::make_address(path);
+        if (m_fd < 0 ||
+            ::bind(m_fd, reinterpret_cast<const sockaddr*>(&address),
+                   sizeof(address)) != 0 ||
+            ::listen(m_fd, SOMAXCONN) != 0) {
+            const std::string error = std::strerror(errno);
+            if (m_fd >= 0) {
+                ::close(m_fd);
+            }
+            throw std::runtime_error("Could not listen at " + path + ": " +
+                                     error);
+        }
+    }
+
+    ~event_socket_listener() {
+        ::close(m_fd);
+        ::unlink(m_path.c_str());
+    }
+
+    event_socket_listener(const event_socket_listener&) = delete;
+    event_socket_listener& operator=(const event_socket_listener&) = delete;
+
+    /// Wait for the next client
+    event_socket accept() {
+        while (true) {
+            const int fd = ::accept(m_fd, nullptr, nullptr);
+            if (fd >= 0) {
+                return event_socket(fd);
+            }
+            if (errno != EINTR) {
+                throw std::runtime_error(std::string("Could not accept: ") +
+                                         std::strerror(errno));
+            }
+        }
+    }
+
+    private:
+    /// Path of the socket file
+    std::string m_path;
+    /// The listening socket
+    int m_fd = -1;
+
+};  // class event_socket_listener
+
+/// The events of one request, as received by the daemon
+///
+/// Every event is one cell block, laid out as in a cell file, so the cells
+/// are handed to the chain without being copied again.
+///
+struct event_request {
+    /// Kind of the request
+    request_type type = request_type::reconstruct;
+    /// Number of every event
+    std::vector<std::uint64_t> events;
+    /// Number of cells in every event
+    std::vector<std::uint64_t> n_cells;
+    /// Cell block of every event
+    std::vector<std::vector<std::byte>> blocks;
+
+    /// Number of events in the request
+    std::size_t size() const { return events.size(); }
+    /// View of the cells of event @c i of the request
+    edm::silicon_cell_collection::const_view cells(std::size_t i) const {
+        return details::cell_block_view(blocks[i].data(), n_cells[i]);
+    }
+};
+
+/// Send the cells of events with consecutive numbers in one request
+inline void send_request(
+    event_socket& socket, std::uint64_t first_event,
+    std::span<const edm::silicon_cell_collection::const_view> events) {
+
+    details::request_header header{};
+    std::memcpy(header.magic, details::request_magic, sizeof(header.magic));
+    header.type = static_cast<std::uint32_t>(request_type::reconstruct);
+    header.n_events = static_cast<std::uint32_t>(events.size());
+    header.column_sizes = details::cell_column_sizes;
+    socket.send(&header, sizeof(header));
+
+    std::vector<std::byte> block;
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        const details::request_event_header event{
+            first_event + i,
+            edm::silicon_cell_collection::const_device(events[i]).size()};
+        block.resize(details::cell_block_size(event.n_cells));
+        details::pack_cell_block(events[i], block.data());
+        socket.send(&event, sizeof(event));
+        socket.send(block.data(), block.size());
+    }
+}
+
+/// Ask the daemon to stop
+inline void send_shutdown(event_socket& socket) {
+    details::request_header header{};
+    std::memcpy(header.magic, details::request_magic, sizeof(header.magic));
+    header.type = static_cast<std::uint32_t>(request_type::shutdown);
+    header.column_sizes = details::cell_column_sizes;
+    socket.send(&header, sizeof(header));
+}
+
+/// Receive the next request of a client
+///
+/// @return Nothing, once the client closed the connection
+///
+inline std::optional<event_request> receive_request(event_socket& socket) {
+
+    details::request_header header{};
+    if (!socket.receive(&header, sizeof(header))) {
+        return std::nullopt;
+    }
+    if (std::memcmp(header.magic, details::request_magic,
+                    sizeof(header.magic)) != 0 ||
+        header.column_sizes != details::cell_column_sizes) {
+        throw std::runtime_error("Request of an incompatible client");
+    }
+
+    event_request request;
+    switch (static_cast<request_type>(header.type)) {
+        case request_type::reconstruct:
+        case request_type::shutdown:
+            request.type = static_cast<request_type>(header.type);
+            break;
+        default:
+            throw std::runtime_error("Unknown request type " +
+                                     std::to_string(header.type));
+    }
+    if (header.n_events > details::max_events_per_request) {
+        throw std::runtime_error("Request with too many events (" +
+                                 std::to_string(header.n_events) + ")");
+    }
+    for (std::uint32_t i = 0; i < header.n_events; ++i) {
+        details::request_event_header event{};
+        if (!socket.receive(&event, sizeof(event))) {
+            throw std::runtime_error("Connection closed mid-request");
+        }
+        if (event.n_cells > details::max_cells_per_event) {
+            throw std::runtime_error("Request event with too many cells (" +
+                                     std::to_string(event.n_cells) + ")");
+        }
+        request.events.push_back(event.event);
+        request.n_cells.push_back(event.n_cells);
+        request.blocks.emplace_back(details::cell_block_size(event.n_cells));
+        if (!socket.receive(request.blocks.back().data(),
+                            request.blocks.back().size())) {
+            throw std::runtime_error("Connection closed mid-request");
+        }
+    }
+    return request;
+}
+
+/// Send the fitted tracks of one event
+///
+/// @param socket              The client connection
+/// @param table               The fitted tracks
+/// @param reconstruction_time Time spent reconstructing the event
+/// @param ok                  Whether the reconstruction succeeded; the
+///                            table is empty if not
+///
+inline void send_response(event_socket& socket,
+                          const track_state_table& table,
+                          double reconstruction_time, bool ok = true) {
+
+    const details::response_header header{
+        table.event,
+        table.n_tracks(),
+        table.state_surface.size(),
+        static_cast<std::uint32_t>(table.parametrization),
+        ok ? 1u : 0u,
+        reconstruction_time};
+    socket.send(&header, sizeof(header));
+    details::for_each_track_column(
+        table, [&socket](details::track_column, const auto& column) {
+            socket.send(column.data(), column.size() * sizeof(column[0]));
+        });
+}
+
+/// The answer of the daemon to one event
+struct event_response {
+    /// The fitted tracks
+    track_state_table tracks;
+    /// Whether the event was reconstructed
+    bool ok = false;
+    /// Time the daemon spent reconstructing the event, in seconds
+    double reconstruction_time = 0.;
+};
+
+/// Receive the answer to the next event of a request
+inline event_response receive_response(event_socket& socket) {
+
+    details::response_header header{};
+    if (!socket.receive(&header, sizeof(header))) {
+        throw std::runtime_error("The daemon closed the connection");
+    }
+    if (header.n_tracks > details::max_tracks_per_event ||
+        header.n_states > details::max_states_per_event) {
+        throw std::runtime_error(
+            "Response with too many tracks (" +
+            std::to_string(header.n_tracks) + ") or states (" +
+            std::to_string(header.n_states) + ")");
+    }
+    event_response response;
+    response.ok = (header.ok != 0u);
+    response.reconstruction_time = header.reconstruction_time;
+    response.tracks.event = header.event;
+    response.tracks.parametrization =
+        static_cast<track_parametrization>(header.parametrization);
+    details::for_each_track_column(
+        response.tracks,
+        [&socket, &header](details::track_column c, auto& column) {
+            column.resize(static_cast<std::size_t>(c) <
+                                  details::n_per_track_columns
+                              ? header.n_tracks
+                              : header.n_states);
+            if (!socket.receive(column.data(),
+                                column.size() * sizeof(column[0]))) {
+                throw std::runtime_error("Connection closed mid-response");
+            }
+        });
+    return response;
+}
+
+}  // namespace traccc::tutorial
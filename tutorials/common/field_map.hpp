@@ -0,0 +1,323 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Regular grid of the points of a field map
+struct field_grid {
+    /// Number of points along x, y and z
+    std::array<std::uint64_t, 3> n{};
+    /// Position of the first point
+    std::array<double, 3> min{};
+    /// Distance between neighbouring points
+    std::array<double, 3> spacing{};
+};
+
+namespace details {
+
+/// Header at the start of a field map file
+struct field_map_header {
+    /// File identifier
+    char magic[8];
+    /// The grid of the points
+    field_grid grid;
+};
+
+/// Magic bytes of a field map file
+inline constexpr char field_map_magic[8] = {'T', 'U', 'T', 'F',
+                                            'M', 'A', 'P', '1'};
+
+}  // namespace details
+
+/// Magnetic field map with trilinear interpolation
+///
+/// The file stores the field at the points of a regular grid, x running
+/// fastest. When loading, the grid is re-arranged into bricks of 4x4x4
+/// cells, each brick holding its own copy of its 5x5x5 corner points, so the
+/// eight corners of any cell are in one small contiguous block of memory.
+/// Every point is padded to four floats, so that the interpolation works on
+/// whole SIMD registers.
+///
+/// Lookups take a @c cache_type, which remembers the last cell. A stepper
+/// keeps one cache per track: the Runge-Kutta stages of a step, and usually
+/// several consecutive steps, fall into the same cell and skip the cell
+/// search. Outside of the grid the field is zero.
+///
+class field_map {
+
+    public:
+    /// Cells per brick along every axis
+    static constexpr std::size_t brick_cells = 4u;
+    /// Points per brick along every axis
+    static constexpr std::size_t brick_points = brick_cells + 1u;
+
+    /// Field at one grid point, padded to a SIMD register
+    struct alignas(16) point_value {
+        float v[4];
+    };
+
+    /// The last cell found by a lookup
+    struct cache_type {
+        /// First corner of the cell, @c nullptr if there is no cell yet
+        const point_value* corner = nullptr;
+        /// Position of the first corner
+        std::array<double, 3> origin{};
+    };
+
+    /// Write a field map file
+    ///
+    /// @param path  The file to write
+    /// @param grid  The grid of the map
+    /// @param field Callable returning the field (as a @c vector3) at a
+    ///              global position (as a @c point3)
+    ///
+    template <typename field_function_t>
+    static void write(const std::string& path, const field_grid& grid,
+                      field_function_t&& field) {
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        details::field_map_header header{};
+        std::memcpy(header.magic, details::field_map_magic,
+                    sizeof(header.magic));
+        header.grid = grid;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        std::vector<float> row(3u * grid.n[0]);
+        for (std::uint64_t k = 0; k < grid.n[2]; ++k) {
+            for (std::uint64_t j = 0; j < grid.n[1]; ++j) {
+                for (std::uint64_t i = 0; i < grid.n[0]; ++i) {
+                    const point3 pos{
+                        static_cast<scalar>(grid.min[0] +
+                                            static_cast<double>(i) *
+                                                grid.spacing[0]),
+                        static_cast<scalar>(grid.min[1] +
+                                            static_cast<double>(j) *
+                                                grid.spacing[1]),
+                        static_cast<scalar>(grid.min[2] +
+                                            static_cast<double>(k) *
+                                                grid.spacing[2])};
+                    const vector3 B = field(pos);
+                    for (std::size_t c = 0; c < 3u; ++c) {
+                        row[3u * i + c] = static_cast<float>(B[c]);
+                    }
+                }
+                out.write(reinterpret_cast<const char*>(row.data()),
+                          static_cast<std::streamsize>(row.size() *
+                                                       sizeof(float)));
+            }
+        }
+        if (!out) {
+            throw std::runtime_error("Could not write " + path);
+        }
+    }
+
+    /// Read a field map file written by @c write
+    explicit field_map(const std::string& path) {
+
+        std::ifstream in(path, std::ios::binary);
+        details::field_map_header header{};
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!in || std::memcmp(header.magic, details::field_map_magic,
+                               sizeof(header.magic)) != 0) {
+            throw std::runtime_error(path + " is not a field map");
+        }
+        m_grid = header.grid;
+        for (std::size_t a = 0; a < 3u; ++a) {
+            if (m_grid.n[a] < 2u || !(m_grid.spacing[a] > 0.)) {
+                throw std::runtime_error(path + " has an invalid grid");
+            }
+            m_n_cells[a] = m_grid.n[a] - 1u;
+            m_n_bricks[a] = (m_n_cells[a] + brick_cells - 1u) / brick_cells;
+            m_inv_spacing[a] = 1. / m_grid.spacing[a];
+        }
+
+        std::vector<float> values(3u * m_grid.n[0] * m_grid.n[1] *
+                                  m_grid.n[2]);
+        in.read(reinterpret_cast<char*>(values.data()),
+                static_cast<std::streamsize>(values.size() * sizeof(float)));
+        if (!in) {
+            throw std::runtime_error(path + " is truncated");
+        }
+
+        // Copy the points into the bricks. Brick points beyond the edge of
+        // the grid are clamped to it; they never take part in a lookup.
+        m_bricks.resize(m_n_bricks[0] * m_n_bricks[1] * m_n_bricks[2] *
+                        brick_points * brick_points * brick_points);
+        const auto clamp = [&](std::size_t a, std::uint64_t i) {
+            return std::min<std::uint64_t>(i, m_grid.n[a] - 1u);
+        };
+        for (std::uint64_t bz = 0; bz < m_n_bricks[2]; ++bz) {
+            for (std::uint64_t by = 0; by < m_n_bricks[1]; ++by) {
+                for (std::uint64_t bx = 0; bx < m_n_bricks[0]; ++bx) {
+                    point_value* brick = brick_begin(bx, by, bz);
+                    for (std::size_t lz = 0; lz < brick_points; ++lz) {
+                        for (std::size_t ly = 0; ly < brick_points; ++ly) {
+                            for (std::size_t lx = 0; lx < brick_points; ++lx) {
+                                const std::uint64_t i =
+                                    clamp(0u, bx * brick_cells + lx);
+                                const std::uint64_t j =
+                                    clamp(1u, by * brick_cells + ly);
+                                const std::uint64_t k =
+                                    clamp(2u, bz * brick_cells + lz);
+                                const float* src =
+                                    &values[3u * (i + m_grid.n[0] *
+                                                          (j + m_grid.n[1] * k))];
+                                point_value& dst =
+                                    brick[(lz * brick_points + ly) *
+                                              brick_points +
+                                          lx];
+                                dst = {{src[0], src[1], src[2], 0.f}};
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /// The grid of the map
+    const field_grid& grid() const { return m_grid; }
+
+    /// Field at a position, without a cache
+    vector3 at(const point3& pos) const {
+        cache_type cache;
+        return at(pos, cache);
+    }
+
+    /// Field at a position, using and updating the cell cache of a track
+    vector3 at(const point3& pos, cache_type& cache) const {
+
+        std::array<double, 3> frac;
+        bool hit = (cache.corner != nullptr);
+        for (std::size_t a = 0; a < 3u && hit; ++a) {
+            frac[a] = (static_cast<double>(pos[a]) - cache.origin[a]) *
+                      m_inv_spacing[a];
+            hit = (frac[a] >= 0. && frac[a] < 1.);
+        }
+        if (!hit && !find_cell(pos, cache, frac)) {
+            return {0.f, 0.f, 0.f};
+        }
+        return interpolate(cache.corner, frac);
+    }
+
+    private:
+    /// Find the cell of a position, and put it into the cache
+    ///
+    /// @return @c false if the position is outside of the grid
+    ///
+    bool find_cell(const point3& pos, cache_type& cache,
+                   std::array<double, 3>& frac) const {
+
+        std::array<std::uint64_t, 3> cell;
+        for (std::size_t a = 0; a < 3u; ++a) {
+            const double u =
+                (static_cast<double>(pos[a]) - m_grid.min[a]) * m_inv_spacing[a];
+            if (!(u >= 0.) || u >= static_cast<double>(m_n_cells[a])) {
+                cache.corner = nullptr;
+                return false;
+            }
+            cell[a] = static_cast<std::uint64_t>(u);
+            frac[a] = u - static_cast<double>(cell[a]);
+            cache.origin[a] =
+                m_grid.min[a] + static_cast<double>(cell[a]) * m_grid.spacing[a];
+        }
+        const point_value* brick =
+            brick_begin(cell[0] / brick_cells, cell[1] / brick_cells,
+                        cell[2] / brick_cells);
+        cache.corner =
+            brick + ((cell[2] % brick_cells) * brick_points +
+                     (cell[1] % brick_cells)) *
+                            brick_points +
+                    (cell[0] % brick_cells);
+        return true;
+    }
+
+    /// Trilinear interpolation inside the cell starting at @c corner
+    static vector3 interpolate(const point_value* corner,
+                               const std::array<double, 3>& frac) {
+
+        constexpr std::size_t dy = brick_points;
+        constexpr std::size_t dz = brick_points * brick_points;
+        const auto fx = static_cast<float>(frac[0]);
+        const auto fy = static_cast<float>(frac[1]);
+        const auto fz = static_cast<float>(frac[2]);
+
+        // Linear interpolation of all four components at once
+        const auto lerp = [](const point_value& a, const point_value& b,
+                             float f) {
+            point_value r;
+            for (std::size_t c = 0; c < 4u; ++c) {
+                r.v[c] = a.v[c] + f * (b.v[c] - a.v[c]);
+            }
+            return r;
+        };
+        const point_value c00 = lerp(corner[0], corner[1], fx);
+        const point_value c10 = lerp(corner[dy], corner[dy + 1u], fx);
+        const point_value c01 = lerp(corner[dz], corner[dz + 1u], fx);
+        const point_value c11 =
+            lerp(corner[dz + dy], corner[dz + dy + 1u], fx);
+        const point_value c0 = lerp(c00, c10, fy);
+        const point_value c1 = lerp(c01, c11, fy);
+        const point_value r = lerp(c0, c1, fz);
+        return {static_cast<scalar>(r.v[0]), static_cast<scalar>(r.v[1]),
+                static_cast<scalar>(r.v[2])};
+    }
+
+    /// First point of a brick
+    point_value* brick_begin(std::uint64_t bx, std::uint64_t by,
+                             std::uint64_t bz) {
+        return &m_bricks[((bz * m_n_bricks[1] + by) * m_n_bricks[0] + bx) *
+                         brick_points * brick_points * brick_points];
+    }
+    const point_value* brick_begin(std::uint64_t bx, std::uint64_t by,
+                                   std::uint64_t bz) const {
+        return &m_bricks[((bz * m_n_bricks[1] + by) * m_n_bricks[0] + bx) *
+                         brick_points * brick_points * brick_points];
+    }
+
+    /// The grid of the map
+    field_grid m_grid;
+    /// Number of cells along every axis
+    std::array<std::uint64_t, 3> m_n_cells{};
+    /// Number of bricks along every axis
+    std::array<std::uint64_t, 3> m_n_bricks{};
+    /// Inverse of the grid spacing
+    std::array<double, 3> m_inv_spacing{};
+    /// The field values, brick by brick
+    std::vector<point_value> m_bricks;
+
+};  // class field_map
+
+/// A constant field, with the lookup interface of @c field_map
+struct uniform_field {
+    /// No cell to remember
+    struct cache_type {};
+
+    vector3 B;
+
+    vector3 at(const point3&) const { return B; }
+    vector3 at(const point3&, cache_type&) const { return B; }
+};
+
+}  // namespace traccc::tutorial
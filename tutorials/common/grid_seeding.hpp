@@ -0,0 +1,439 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/detector_utils.hpp"
+#include "common/instrumentation.hpp"
+#include "common/telescope_navigator.hpp"
+#include "common/thread_pool.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/spacepoint.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of @c grid_seeding
+struct grid_seeding_config {
+    /// Largest |dy/dx| and |dz/dx| of a doublet
+    scalar max_slope = 0.25f;
+    /// Largest change of dz/dx between the two doublets of a triplet (the
+    /// field bends the tracks in x-y only)
+    scalar max_slope_change = 0.01f;
+    /// Smallest transverse momentum, from the curvature in x-y
+    scalar min_pt = 0.5f * unit<scalar>::GeV;
+    /// Position the tracks come from (the production vertex of the event
+    /// generator)
+    point3 beam_spot{-50.f * unit<scalar>::mm, 0.f, 0.f};
+    /// Largest distance in z from the beam spot of the bottom doublet's line
+    /// in x-z, at the x of the beam spot
+    scalar max_z_distance = 1.f * unit<scalar>::mm;
+    /// Largest distance of the seed's circle in x-y from the beam spot
+    scalar max_impact = 1.f * unit<scalar>::mm;
+    /// Largest number of seeds with the same middle spacepoint
+    unsigned int max_seeds_per_middle = 2u;
+    /// Half width of the grid in y and z; spacepoints further out go into
+    /// the outermost bins
+    scalar grid_half_width = 250.f * unit<scalar>::mm;
+    /// Spacepoints per binning block, and middle spacepoints per search task
+    std::size_t min_spacepoints_per_task = 1024u;
+};
+
+/// Triplet seeding of the telescope with a persistent spacepoint grid
+///
+/// The spacepoints are binned by plane, y and z. The bins are as wide as the
+/// largest distance a doublet can move in y or z between two neighbouring
+/// planes, so the partners of a spacepoint are always in the 3x3 bins
+/// around its own bin on the neighbouring planes.
+///
+/// The grid is a compressed (CSR) bin table whose storage belongs to the
+/// algorithm: every event only clears and refills it, so after the first
+/// event the binning does not allocate. Binning runs in three parallel
+/// steps over blocks of spacepoints: a per-block histogram of the bins, a
+/// prefix sum giving every block its offset in every bin, and a scatter of
+/// the spacepoint indices. The doublet and triplet search then runs in
+/// parallel over ranges of middle bins, each task writing into its own
+/// (also persistent) seed buffer. Blocks and tasks are concatenated in
+/// order, so the seeds do not depend on the number of threads.
+///
+/// Since the storage is reused, an instance must not be used by several
+/// threads at once; the reconstruction chain has one per worker.
+///
+class grid_seeding {
+
+    public:
+    /// Construct the algorithm
+    ///
+    /// @param cfg     The algorithm configuration
+    /// @param modules The sensitive modules, one per plane
+    /// @param B       The (constant) magnetic field, along z
+    /// @param mr      Memory resource for the output seeds
+    /// @param pool    Thread pool for the binning and the search, if any
+    ///
+    grid_seeding(const grid_seeding_config& cfg,
+                 const std::vector<module_placement>& modules,
+                 const vector3& B, vecmem::memory_resource& mr,
+                 thread_pool* pool = nullptr)
+        : m_cfg(cfg),
+          m_max_curvature(std::abs(B[2]) / cfg.min_pt),
+          m_mr(mr),
+          m_pool(pool) {
+
+        // Planes in position order, from the navigator
+        const telescope_navigator navigator(modules, B);
+        m_n_planes = navigator.size();
+        scalar max_gap = 0.f;
+        for (std::size_t p = 0; p < m_n_planes; ++p) {
+            const std::size_t surface =
+                modules[navigator.plane_module(p)].barcode.index();
+            if (surface >= m_surface_plane.size()) {
+                m_surface_plane.resize(surface + 1u, -1);
+            }
+            m_surface_plane[surface] = static_cast<int>(p);
+            if (p > 0u) {
+                max_gap = std::max(
+                    max_gap, static_cast<scalar>(navigator.plane_position(p) -
+                                                 navigator.plane_position(p - 1u)));
+            }
+        }
+        m_bin_width = std::max(cfg.max_slope * max_gap, 1.f * unit<scalar>::mm);
+        m_n_side = std::max<std::size_t>(
+            static_cast<std::size_t>(
+                std::ceil(2.f * cfg.grid_half_width / m_bin_width)),
+            1u);
+    }
+
+    /// Find the seeds of an event
+    ///
+    /// @param spacepoints The spacepoints of the event
+    /// @return Seeds pointing into @c spacepoints
+    ///
+    seed_collection_types::host operator()(
+        const spacepoint_collection_types::host& spacepoints) const {
+
+        fill_grid(spacepoints);
+        find_triplets(spacepoints);
+
+        seed_collection_types::host result{&m_mr};
+        std::size_t n_seeds = 0;
+        for (const auto& seeds : m_task_seeds) {
+            n_seeds += seeds.size();
+        }
+        result.reserve(n_seeds);
+        for (const auto& seeds : m_task_seeds) {
+            result.insert(result.end(), seeds.begin(), seeds.end());
+        }
+        return result;
+    }
+
+    private:
+    /// Run @c fn(i) for i in [0, n), on the pool if there is one
+    template <typename function_t>
+    void run(std::size_t n, const function_t& fn) const {
+        if (m_pool != nullptr && n > 1u) {
+            m_pool->parallel_for(n,
+                                 [&fn](std::size_t i, std::size_t) { fn(i); });
+        } else {
+            for (std::size_t i = 0; i < n; ++i) {
+                fn(i);
+            }
+        }
+    }
+
+    /// Number of bins
+    std::size_t n_bins() const { return m_n_planes * m_n_side * m_n_side; }
+
+    /// Bin index along y or z of a coordinate
+    std::size_t side_bin(scalar u) const {
+        const scalar b = (u + m_cfg.grid_half_width) / m_bin_width;
+        return (b <= 0.f) ? 0u
+                          : std::min(static_cast<std::size_t>(b), m_n_side - 1u);
+    }
+
+    /// Bin of a spacepoint, or @c n_bins() if it is not on a plane
+    std::size_t bin_of(const spacepoint& sp) const {
+        const std::size_t surface = sp.meas.surface_link.index();
+        if (surface >= m_surface_plane.size() || m_surface_plane[surface] < 0) {
+            return n_bins();
+        }
+        const auto plane = static_cast<std::size_t>(m_surface_plane[surface]);
+        return (plane * m_n_side + side_bin(sp.global[1])) * m_n_side +
+               side_bin(sp.global[2]);
+    }
+
+    /// Bin the spacepoints: histogram, prefix sum and scatter
+    void fill_grid(const spacepoint_collection_types::host& spacepoints) const {
+
+        TUTORIAL_SCOPED_TIMER(seeding_binning);
+        const std::size_t n = spacepoints.size();
+        const std::size_t per_block =
+            std::max<std::size_t>(m_cfg.min_spacepoints_per_task, 1u);
+        const std::size_t n_blocks =
+            std::max<std::size_t>((n + per_block - 1u) / per_block, 1u);
+        const std::size_t block_size = (n + n_blocks - 1u) / n_blocks;
+        // One extra bin collects the spacepoints that are not on a plane.
+        const std::size_t n_counts = n_bins() + 1u;
+
+        m_sp_bin.resize(n);
+        m_block_counts.assign(n_blocks * n_counts, 0u);
+        run(n_blocks, [&](std::size_t block) {
+            unsigned int* counts = &m_block_counts[block * n_counts];
+            const std::size_t end = std::min(n, (block + 1u) * block_size);
+            for (std::size_t i = block * block_size; i < end; ++i) {
+                m_sp_bin[i] = static_cast<unsigned int>(bin_of(spacepoints[i]));
+                ++counts[m_sp_bin[i]];
+            }
+        });
+
+        // Bin offsets, and the offset of every block within every bin
+        m_bin_begin.resize(n_counts + 1u);
+        unsigned int offset = 0;
+        for (std::size_t bin = 0; bin < n_counts; ++bin) {
+            m_bin_begin[bin] = offset;
+            for (std::size_t block = 0; block < n_blocks; ++block) {
+                unsigned int& count = m_block_counts[block * n_counts + bin];
+                const unsigned int size = count;
+                count = offset;
+                offset += size;
+            }
+        }
+        m_bin_begin[n_counts] = offset;
+
+        m_bin_spacepoints.resize(n);
+        run(n_blocks, [&](std::size_t block) {
+            unsigned int* offsets = &m_block_counts[block * n_counts];
+            const std::size_t end = std::min(n, (block + 1u) * block_size);
+            for (std::size_t i = block * block_size; i < end; ++i) {
+                m_bin_spacepoints[offsets[m_sp_bin[i]]++] =
+                    static_cast<unsigned int>(i);
+            }
+        });
+    }
+
+    /// Search the triplets, in parallel over ranges of middle bins
+    void find_triplets(
+        const spacepoint_collection_types::host& spacepoints) const {
+
+        TUTORIAL_SCOPED_TIMER(seeding_triplet_search);
+        for (auto& seeds : m_task_seeds) {
+            seeds.clear();
+        }
+        if (m_n_planes < 3u) {
+            return;
+        }
+
+        // Middle bins are the bins of the inner planes.
+        const std::size_t plane_bins = m_n_side * m_n_side;
+        const std::size_t first_bin = plane_bins;
+        const std::size_t last_bin = (m_n_planes - 1u) * plane_bins;
+        std::vector<std::size_t>& task_begins = m_task_begins;
+        task_begins.assign(1u, first_bin);
+        for (std::size_t bin = first_bin + 1u; bin < last_bin; ++bin) {
+            if (m_bin_begin[bin] - m_bin_begin[task_begins.back()] >=
+                m_cfg.min_spacepoints_per_task) {
+                task_begins.push_back(bin);
+            }
+        }
+        task_begins.push_back(last_bin);
+        const std::size_t n_tasks = task_begins.size() - 1u;
+
+        if (m_task_seeds.size() < n_tasks) {
+            m_task_seeds.resize(n_tasks);
+        }
+        run(n_tasks, [&](std::size_t task) {
+            std::vector<candidate> candidates;
+            for (std::size_t bin = task_begins[task];
+                 bin < task_begins[task + 1u]; ++bin) {
+                for (unsigned int i = m_bin_begin[bin];
+                     i < m_bin_begin[bin + 1u]; ++i) {
+                    middle_seeds(spacepoints, bin, m_bin_spacepoints[i],
+                                 candidates, m_task_seeds[task]);
+                }
+            }
+        });
+    }
+
+    /// A triplet found for a middle spacepoint
+    struct candidate {
+        unsigned int bottom;
+        unsigned int top;
+        scalar slope_change;
+        scalar z_vertex;
+    };
+
+    /// Call @c fn(index) for the spacepoints in the 3x3 bins around
+    /// @c bin, on the plane @c plane_offset planes away
+    template <typename function_t>
+    void for_each_neighbour(std::size_t bin, int plane_offset,
+                            function_t&& fn) const {
+        const std::size_t plane_bins = m_n_side * m_n_side;
+        const std::size_t iy = (bin % plane_bins) / m_n_side;
+        const std::size_t iz = bin % m_n_side;
+        const std::size_t plane_begin =
+            static_cast<std::size_t>(static_cast<long>(bin / plane_bins) +
+                                     plane_offset) *
+            plane_bins;
+        for (std::size_t y = (iy > 0u ? iy - 1u : 0u);
+             y <= std::min(iy + 1u, m_n_side - 1u); ++y) {
+            // The z-neighbours of a y-row are contiguous.
+            const std::size_t row = plane_begin + y * m_n_side;
+            const std::size_t z_begin = row + (iz > 0u ? iz - 1u : 0u);
+            const std::size_t z_end = row + std::min(iz + 1u, m_n_side - 1u);
+            for (unsigned int i = m_bin_begin[z_begin];
+                 i < m_bin_begin[z_end + 1u]; ++i) {
+                fn(m_bin_spacepoints[i]);
+            }
+        }
+    }
+
+    /// Find the seeds with middle spacepoint @c middle
+    void middle_seeds(const spacepoint_collection_types::host& spacepoints,
+                      std::size_t bin, unsigned int middle,
+                      std::vector<candidate>& candidates,
+                      std::vector<seed>& output) const {
+
+        const point3& m = spacepoints[middle].global;
+        const auto compatible = [&](const point3& other) {
+            const scalar dx = other[0] - m[0];
+            return std::abs(other[1] - m[1]) <= m_cfg.max_slope * std::abs(dx) &&
+                   std::abs(other[2] - m[2]) <= m_cfg.max_slope * std::abs(dx);
+        };
+
+        candidates.clear();
+        for_each_neighbour(bin, -1, [&](unsigned int bottom) {
+            const point3& b = spacepoints[bottom].global;
+            if (!compatible(b)) {
+                return;
+            }
+            const scalar slope_bm = (m[2] - b[2]) / (m[0] - b[0]);
+            const scalar z_vertex =
+                b[2] + slope_bm * (m_cfg.beam_spot[0] - b[0]);
+            if (std::abs(z_vertex - m_cfg.beam_spot[2]) >
+                m_cfg.max_z_distance) {
+                return;
+            }
+            TUTORIAL_COUNT(seed_doublets, 1);
+            for_each_neighbour(bin, +1, [&](unsigned int top) {
+                const point3& t = spacepoints[top].global;
+                if (!compatible(t)) {
+                    return;
+                }
+                // Straight line in x-z
+                const scalar slope_change =
+                    std::abs((t[2] - m[2]) / (t[0] - m[0]) - slope_bm);
+                if (slope_change > m_cfg.max_slope_change) {
+                    return;
+                }
+                // Circle in x-y: curvature = 2 sin(angle at m) / |t - b|
+                const scalar ax = m[0] - b[0], ay = m[1] - b[1];
+                const scalar cx = t[0] - m[0], cy = t[1] - m[1];
+                const scalar ex = t[0] - b[0], ey = t[1] - b[1];
+                const scalar cross = ax * cy - ay * cx;
+                const scalar curvature =
+                    2.f * std::abs(cross) /
+                    std::sqrt((ax * ax + ay * ay) * (cx * cx + cy * cy) *
+                              (ex * ex + ey * ey));
+                if (curvature > m_max_curvature ||
+                    impact(b, m, t) > m_cfg.max_impact) {
+                    return;
+                }
+                TUTORIAL_COUNT(seed_triplets, 1);
+                candidates.push_back({bottom, top, slope_change, z_vertex});
+            });
+        });
+
+        // Keep the straightest triplets in x-z.
+        const std::size_t n_keep =
+            std::min<std::size_t>(candidates.size(), m_cfg.max_seeds_per_middle);
+        std::partial_sort(candidates.begin(), candidates.begin() + n_keep,
+                          candidates.end(),
+                          [](const candidate& a, const candidate& c) {
+                              return a.slope_change < c.slope_change;
+                          });
+        for (std::size_t i = 0; i < n_keep; ++i) {
+            seed s;
+            s.spB_link = candidates[i].bottom;
+            s.spM_link = middle;
+            s.spT_link = candidates[i].top;
+            s.weight = -candidates[i].slope_change;
+            s.z_vertex = candidates[i].z_vertex;
+            output.push_back(s);
+        }
+    }
+
+    /// Distance of the circle through @c b, @c m and @c t in x-y from the
+    /// beam spot
+    double impact(const point3& b, const point3& m, const point3& t) const {
+        // In double precision, relative to the middle spacepoint: the
+        // circles of fast tracks have radii of metres.
+        const double ax = b[0] - m[0], ay = b[1] - m[1];
+        const double cx = t[0] - m[0], cy = t[1] - m[1];
+        const double vx = m_cfg.beam_spot[0] - m[0];
+        const double vy = m_cfg.beam_spot[1] - m[1];
+        const double a2 = ax * ax + ay * ay, c2 = cx * cx + cy * cy;
+        const double d = 2. * (ax * cy - ay * cx);
+        if (std::abs(d) < 1e-12 * a2) {
+            // Straight line through b and m
+            return std::abs(ax * vy - ay * vx) / std::sqrt(a2);
+        }
+        const double ux = (cy * a2 - ay * c2) / d;
+        const double uy = (ax * c2 - cx * a2) / d;
+        return std::abs(std::hypot(vx - ux, vy - uy) - std::hypot(ux, uy));
+    }
+
+    /// The algorithm configuration
+    grid_seeding_config m_cfg;
+    /// Largest curvature in x-y, from @c min_pt
+    scalar m_max_curvature;
+    /// Memory resource for the output seeds
+    vecmem::memory_resource& m_mr;
+    /// Thread pool for the binning and the search
+    thread_pool* m_pool;
+
+    /// @name Grid layout
+    /// @{
+    std::size_t m_n_planes = 0u;
+    /// Plane of every surface index, -1 for surfaces that are not planes
+    std::vector<int> m_surface_plane;
+    /// Width of the bins in y and z
+    scalar m_bin_width = 0.f;
+    /// Number of bins along y and along z
+    std::size_t m_n_side = 1u;
+    /// @}
+
+    /// @name Storage reused for every event
+    /// @{
+    /// First entry of every bin in @c m_bin_spacepoints
+    mutable std::vector<unsigned int> m_bin_begin;
+    /// Spacepoint indices, bin by bin
+    mutable std::vector<unsigned int> m_bin_spacepoints;
+    /// Bin of every spacepoint
+    mutable std::vector<unsigned int> m_sp_bin;
+    /// Per-block bin counts, turned into per-block bin offsets
+    mutable std::vector<unsigned int> m_block_counts;
+    /// First middle bin of every search task
+    mutable std::vector<std::size_t> m_task_begins;
+    /// Seeds found by every search task
+    mutable std::vector<std::vector<seed>> m_task_seeds;
+    /// @}
+
+};  // class grid_seeding
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,217 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/thread_pool.hpp"
+
+// traccc include(s).
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/device/fill_sort_keys.hpp"
+#include "traccc/fitting/device/fit.hpp"
+#include "traccc/utils/memory_resource.hpp"
+
+// detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/jagged_vector_buffer.hpp>
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of the host execution of device kernels
+struct host_device_config {
+    /// Number of kernel "threads" run by one task
+    ///
+    /// Plays the role of the CUDA block size: a task runs the indices of one
+    /// block one after another, and the blocks are spread over the pool.
+    ///
+    unsigned int block_size = 64u;
+};
+
+/// Runs a device kernel over @c n indices on the threads of a pool
+///
+/// @param pool  Thread pool for the blocks; without one, all blocks run on
+///              the calling thread
+/// @param cfg   The launch configuration
+/// @param n     Number of kernel "threads"
+/// @param kernel Called as @c kernel(global_index) for every index
+///
+template <typename kernel_t>
+void launch_on_host(thread_pool* pool, const host_device_config& cfg,
+                    std::size_t n, const kernel_t& kernel) {
+
+    const std::size_t block_size = std::max(cfg.block_size, 1u);
+    const std::size_t n_blocks = (n + block_size - 1u) / block_size;
+    const auto run_block = [&](std::size_t block, std::size_t) {
+        const std::size_t end = std::min(n, (block + 1u) * block_size);
+        for (std::size_t i = block * block_size; i < end; ++i) {
+            kernel(i);
+        }
+    };
+    if (pool != nullptr && n_blocks > 1u) {
+        pool->parallel_for(n_blocks, run_block);
+    } else {
+        for (std::size_t block = 0; block < n_blocks; ++block) {
+            run_block(block, 0u);
+        }
+    }
+}
+
+/// The device track fitting, executed on CPU threads
+///
+/// Has the interface of @c traccc::cuda::fitting_algorithm: it takes a view
+/// of the device detector and a buffer of track candidates, and returns a
+/// buffer of track states. The buffers live in the (host) memory resources
+/// given to the constructor, and every step of the CUDA algorithm is
+/// repeated with them: the sizes of the candidates are read with the copy
+/// object, the output buffers are set up, @c traccc::device::fill_sort_keys
+/// is run for every track, the tracks are ordered by their keys, and
+/// @c traccc::device::fit is run for every track.
+///
+/// The kernels are traccc's own device functions, so this is the same
+/// data-parallel formulation as on a GPU, with the CUDA thread grid replaced
+/// by blocks of indices on a @c thread_pool. This allows the device code
+/// path to be profiled with CPU tools, and to be compared with
+/// @c host::kalman_fitting_algorithm on machines without a GPU.
+///
+/// @tparam fitter_t The fitter type, as for the CUDA algorithm
+///
+template <typename fitter_t>
+class host_device_fitting_algorithm {
+
+    public:
+    /// Configuration of the fitter
+    using config_type = typename fitter_t::config_type;
+    /// View of the detector
+    using detector_view_type = typename fitter_t::detector_type::view_type;
+    /// Magnetic field type
+    using bfield_type = typename fitter_t::bfield_type;
+
+    /// Construct the algorithm
+    ///
+    /// @param cfg      Configuration of the fitter
+    /// @param mr       Memory resources of the buffers; both must be host
+    ///                 accessible
+    /// @param copy     Copy object used on the buffers
+    /// @param pool     Thread pool executing the kernels; without one, the
+    ///                 kernels run on the calling thread
+    /// @param host_cfg The launch configuration
+    ///
+    host_device_fitting_algorithm(const config_type& cfg,
+                                  const traccc::memory_resource& mr,
+                                  vecmem::copy& copy,
+                                  thread_pool* pool = nullptr,
+                                  const host_device_config& host_cfg = {})
+        : m_cfg(cfg),
+          m_mr(mr),
+          m_copy(copy),
+          m_pool(pool),
+          m_host_cfg(host_cfg) {}
+
+    /// Fit the track candidates of an event
+    ///
+    /// @param det_view         View of the detector
+    /// @param field            The magnetic field
+    /// @param track_candidates Buffer of the track candidates
+    /// @return Buffer of the fitted track states
+    ///
+    track_state_container_types::buffer operator()(
+        const detector_view_type& det_view, const bfield_type& field,
+        const track_candidate_container_types::const_view& track_candidates)
+        const {
+
+        // Get the sizes of the track candidates in each track
+        const unsigned int n_tracks = m_copy.get_size(track_candidates.headers);
+        const std::vector<unsigned int> candidate_sizes =
+            m_copy.get_sizes(track_candidates.items);
+
+        track_state_container_types::buffer track_states{
+            {n_tracks, m_mr.main},
+            {std::vector<std::size_t>(candidate_sizes.begin(),
+                                      candidate_sizes.end()),
+             m_mr.main, m_mr.host, vecmem::data::buffer_type::resizable}};
+        m_copy.setup(track_states.headers)->ignore();
+        m_copy.setup(track_states.items)->ignore();
+        if (n_tracks == 0u) {
+            return track_states;
+        }
+
+        // Surface sequences of the navigation, as in the CUDA algorithm
+        const unsigned int max_candidates =
+            *std::max_element(candidate_sizes.begin(), candidate_sizes.end());
+        vecmem::data::jagged_vector_buffer<detray::geometry::barcode>
+            sequences{std::vector<std::size_t>(
+                          n_tracks,
+                          std::max(m_cfg.barcode_sequence_size_factor *
+                                       max_candidates,
+                                   m_cfg.min_barcode_sequence_capacity)),
+                      m_mr.main, m_mr.host,
+                      vecmem::data::buffer_type::resizable};
+        m_copy.setup(sequences)->ignore();
+
+        // Order the tracks by their sort keys, so that neighbouring kernel
+        // threads fit similar tracks.
+        vecmem::data::vector_buffer<device::sort_key> keys{n_tracks,
+                                                           m_mr.main};
+        vecmem::data::vector_buffer<unsigned int> param_ids{n_tracks,
+                                                            m_mr.main};
+        m_copy.setup(keys)->ignore();
+        m_copy.setup(param_ids)->ignore();
+        launch_on_host(m_pool, m_host_cfg, n_tracks, [&](std::size_t i) {
+            device::fill_sort_keys(i, track_candidates, keys, param_ids);
+        });
+        {
+            vecmem::device_vector<device::sort_key> key_vec(keys);
+            vecmem::device_vector<unsigned int> id_vec(param_ids);
+            std::vector<unsigned int> order(n_tracks);
+            std::iota(order.begin(), order.end(), 0u);
+            std::stable_sort(order.begin(), order.end(),
+                             [&](unsigned int a, unsigned int b) {
+                                 return key_vec[a] < key_vec[b];
+                             });
+            std::vector<unsigned int> sorted_ids(n_tracks);
+            for (unsigned int i = 0; i < n_tracks; ++i) {
+                sorted_ids[i] = id_vec[order[i]];
+            }
+            std::copy(sorted_ids.begin(), sorted_ids.end(), id_vec.begin());
+        }
+
+        // Run the fitting kernel
+        launch_on_host(m_pool, m_host_cfg, n_tracks, [&](std::size_t i) {
+            device::fit<fitter_t>(i, det_view, field, m_cfg, track_candidates,
+                                  param_ids, track_states, sequences);
+        });
+        return track_states;
+    }
+
+    private:
+    /// Configuration of the fitter
+    config_type m_cfg;
+    /// Memory resources of the buffers
+    traccc::memory_resource m_mr;
+    /// Copy object used on the buffers
+    vecmem::copy& m_copy;
+    /// Thread pool executing the kernels
+    thread_pool* m_pool;
+    /// The launch configuration
+    host_device_config m_host_cfg;
+
+};  // class host_device_fitting_algorithm
+
+}  // namespace traccc::tutorial
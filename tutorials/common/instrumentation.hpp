@@ -0,0 +1,333 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @name Instrumentation macros
+///
+/// With @c TUTORIAL_ENABLE_INSTRUMENTATION defined (the CMake option of the
+/// same name), these record into the instrumentation of the calling thread.
+/// Otherwise they compile to nothing, and the hot paths are unchanged.
+///
+/// @{
+#if defined(TUTORIAL_ENABLE_INSTRUMENTATION)
+/// Add @c N to counter @c NAME
+#define TUTORIAL_COUNT(NAME, N)                                         \
+    ::traccc::tutorial::instrumentation::add(                           \
+        ::traccc::tutorial::instrumentation::counter::NAME,            \
+        static_cast<std::uint64_t>(N))
+/// Time the rest of the enclosing scope as timer @c NAME
+#define TUTORIAL_SCOPED_TIMER(NAME)                                     \
+    const ::traccc::tutorial::instrumentation::scoped_timer            \
+        TUTORIAL_INSTRUMENTATION_CONCAT(tutorial_scoped_timer_, __LINE__){ \
+            ::traccc::tutorial::instrumentation::timer::NAME}
+#define TUTORIAL_INSTRUMENTATION_CONCAT(A, B) \
+    TUTORIAL_INSTRUMENTATION_CONCAT_IMPL(A, B)
+#define TUTORIAL_INSTRUMENTATION_CONCAT_IMPL(A, B) A##B
+#else
+#define TUTORIAL_COUNT(NAME, N) \
+    do {                        \
+    } while (false)
+#define TUTORIAL_SCOPED_TIMER(NAME) \
+    do {                            \
+    } while (false)
+#endif
+/// @}
+
+namespace traccc::tutorial::instrumentation {
+
+/// Whether the instrumentation is compiled in
+#if defined(TUTORIAL_ENABLE_INSTRUMENTATION)
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+/// Counted quantities
+///
+/// @c kf_updates counts the measurement updates of the forward filter of
+/// every fitter of the chain. The counters named after a tutorial component
+/// only count in that component, so they stay zero in chains that do not run
+/// it: the telescope navigator (the navigation benchmarks; the propagation
+/// of the event generator is not counted), the Runge-Kutta propagator (the
+/// field map benchmarks) and the telescope CKF (@c --finding=telescope).
+/// traccc's own navigation, stepping and CKF are not instrumented.
+///
+enum class counter : std::size_t {
+    events = 0,
+    measurements,
+    spacepoints,
+    seeds,
+    track_candidates,
+    fitted_tracks,
+    seed_doublets,
+    seed_triplets,
+    telescope_navigator_tests,
+    rk_propagator_steps,
+    kf_updates,
+    telescope_ckf_branches_created,
+    telescope_ckf_branches_pruned,
+    ambiguous_tracks_removed,
+    product_cache_hits,
+    product_cache_misses,
+    n_counters
+};
+
+/// Timed regions; the first six are the stages of the chain
+enum class timer : std::size_t {
+    clusterization = 0,
+    spacepoint_formation,
+    seeding,
+    track_params_estimation,
+    track_finding,
+    track_fitting,
+    seeding_binning,
+    seeding_triplet_search,
+    batched_fit_batch,
+    ambiguity_resolution,
+    n_timers
+};
+
+inline constexpr std::size_t n_counters =
+    static_cast<std::size_t>(counter::n_counters);
+inline constexpr std::size_t n_timers =
+    static_cast<std::size_t>(timer::n_timers);
+
+/// Printable name of a counter
+inline constexpr std::string_view name(counter c) {
+    constexpr std::array<std::string_view, n_counters> names{
+        "events",
+        "measurements",
+        "spacepoints",
+        "seeds",
+        "track_candidates",
+        "fitted_tracks",
+        "seed_doublets",
+        "seed_triplets",
+        "telescope_navigator_tests",
+        "rk_propagator_steps",
+        "kf_updates",
+        "telescope_ckf_branches_created",
+        "telescope_ckf_branches_pruned",
+        "ambiguous_tracks_removed",
+        "product_cache_hits",
+        "product_cache_misses"};
+    return names[static_cast<std::size_t>(c)];
+}
+
+/// Printable name of a timer
+inline constexpr std::string_view name(timer t) {
+    constexpr std::array<std::string_view, n_timers> names{
+        "clusterization",   "spacepoint_formation",   "seeding",
+        "track_params_est", "track_finding",          "track_fitting",
+        "seeding_binning",  "seeding_triplet_search", "batched_fit_batch",
+        "ambiguity_resolution"};
+    return names[static_cast<std::size_t>(t)];
+}
+
+/// Counters and timers of one thread
+///
+/// Every thread writes only to its own record, with plain (non-atomic)
+/// increments, and records are aligned to cache lines so that neighbouring
+/// threads do not share one.
+///
+struct alignas(64) thread_record {
+    std::array<std::uint64_t, n_counters> counters{};
+    std::array<std::uint64_t, n_timers> calls{};
+    std::array<double, n_timers> seconds{};
+
+    /// Accumulate another record
+    thread_record& operator+=(const thread_record& other) {
+        for (std::size_t i = 0; i < n_counters; ++i) {
+            counters[i] += other.counters[i];
+        }
+        for (std::size_t i = 0; i < n_timers; ++i) {
+            calls[i] += other.calls[i];
+            seconds[i] += other.seconds[i];
+        }
+        return *this;
+    }
+};
+
+/// The records of all threads that ever recorded something
+///
+/// Records are owned by the registry, so they outlive the threads (e.g. of
+/// a thread pool) that wrote them. Reading them is only safe when no other
+/// thread is recording, i.e. after the pools of a run have finished.
+///
+class registry {
+
+    public:
+    /// The single instance
+    static registry& instance() {
+        static registry r;
+        return r;
+    }
+
+    /// The record of the calling thread
+    thread_record& local() {
+        thread_local thread_record* record = add();
+        return *record;
+    }
+
+    /// Copies of the records, in the order the threads first recorded
+    std::vector<thread_record> records() const {
+        std::lock_guard lock{m_mutex};
+        std::vector<thread_record> result;
+        for (const auto& r : m_records) {
+            result.push_back(*r);
+        }
+        return result;
+    }
+
+    /// Zero all records, e.g. between runs
+    void reset() {
+        std::lock_guard lock{m_mutex};
+        for (auto& r : m_records) {
+            *r = thread_record{};
+        }
+    }
+
+    private:
+    thread_record* add() {
+        std::lock_guard lock{m_mutex};
+        m_records.push_back(std::make_unique<thread_record>());
+        return m_records.back().get();
+    }
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<thread_record>> m_records;
+
+};  // class registry
+
+/// Add @c n to a counter of the calling thread
+inline void add(counter c, std::uint64_t n) {
+    registry::instance().local().counters[static_cast<std::size_t>(c)] += n;
+}
+
+/// Add a timed interval to a timer of the calling thread
+inline void add(timer t, std::chrono::duration<double> elapsed) {
+    thread_record& r = registry::instance().local();
+    ++r.calls[static_cast<std::size_t>(t)];
+    r.seconds[static_cast<std::size_t>(t)] += elapsed.count();
+}
+
+/// Adds its lifetime to a timer of the calling thread
+class scoped_timer {
+
+    public:
+    explicit scoped_timer(timer t)
+        : m_timer(t), m_start(std::chrono::steady_clock::now()) {}
+    ~scoped_timer() {
+        add(m_timer, std::chrono::steady_clock::now() - m_start);
+    }
+
+    scoped_timer(const scoped_timer&) = delete;
+    scoped_timer& operator=(const scoped_timer&) = delete;
+
+    private:
+    timer m_timer;
+    std::chrono::steady_clock::time_point m_start;
+
+};  // class scoped_timer
+
+/// Write the records of every thread, and their sum, as JSON
+inline void write_json(std::ostream& out,
+                       const std::vector<thread_record>& records) {
+
+    thread_record total;
+    for (const auto& r : records) {
+        total += r;
+    }
+    const auto write_record = [&out](const thread_record& r,
+                                     std::string_view indent) {
+        out << "{\n" << indent << "  \"counters\": {";
+        for (std::size_t i = 0; i < n_counters; ++i) {
+            out << (i > 0u ? ", " : "") << "\"" << name(static_cast<counter>(i))
+                << "\": " << r.counters[i];
+        }
+        out << "},\n" << indent << "  \"timers\": {";
+        for (std::size_t i = 0; i < n_timers; ++i) {
+            out << (i > 0u ? ", " : "") << "\"" << name(static_cast<timer>(i))
+                << "\": {\"calls\": " << r.calls[i]
+                << ", \"seconds\": " << r.seconds[i] << "}";
+        }
+        out << "}\n" << indent << "}";
+    };
+
+    out << "{\n  \"total\": ";
+    write_record(total, "  ");
+    out << ",\n  \"threads\": [";
+    for (std::size_t t = 0; t < records.size(); ++t) {
+        out << (t > 0u ? ", " : "");
+        write_record(records[t], "  ");
+    }
+    out << "]\n}\n";
+}
+
+/// Write the records of every thread, and their sum, as CSV
+///
+/// One row per thread and quantity, with columns
+/// @c thread,kind,name,calls,value; the sum has thread @c total.
+///
+inline void write_csv(std::ostream& out,
+                      const std::vector<thread_record>& records) {
+
+    thread_record total;
+    for (const auto& r : records) {
+        total += r;
+    }
+    const auto write_record = [&out](const thread_record& r,
+                                     const std::string& thread) {
+        for (std::size_t i = 0; i < n_counters; ++i) {
+            out << thread << ",counter," << name(static_cast<counter>(i))
+                << ",," << r.counters[i] << "\n";
+        }
+        for (std::size_t i = 0; i < n_timers; ++i) {
+            out << thread << ",timer," << name(static_cast<timer>(i)) << ","
+                << r.calls[i] << "," << r.seconds[i] << "\n";
+        }
+    };
+
+    out << "thread,kind,name,calls,value\n";
+    write_record(total, "total");
+    for (std::size_t t = 0; t < records.size(); ++t) {
+        write_record(records[t], std::to_string(t));
+    }
+}
+
+/// Write the current records to a file, as CSV if its name ends in
+/// ".csv" and as JSON otherwise
+inline void write(const std::string& path) {
+
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("Could not open " + path);
+    }
+    const auto records = registry::instance().records();
+    if (path.size() >= 4u && path.compare(path.size() - 4u, 4u, ".csv") == 0) {
+        write_csv(out, records);
+    } else {
+        write_json(out, records);
+    }
+}
+
+}  // namespace traccc::tutorial::instrumentation
@@ -0,0 +1,116 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/radix_sort.hpp"
+
+// traccc include(s).
+#include "traccc/edm/measurement.hpp"
+
+// detray include(s).
+#include "detray/geometry/barcode.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Measurements of one surface, as a range of a sorted collection
+struct measurement_range {
+    unsigned int begin = 0u;
+    unsigned int end = 0u;
+
+    /// Number of measurements on the surface
+    unsigned int size() const { return end - begin; }
+    /// Whether there are no measurements on the surface
+    bool empty() const { return begin == end; }
+};
+
+/// Measurements sorted by surface, with a per-surface range table
+///
+/// Construction sorts a measurement collection by geometry barcode with a
+/// stable radix sort, in O(n) instead of the O(n log n) of @c std::sort
+/// with @c measurement_sort_comp. Only the bytes of the barcode that differ
+/// between the measurements are sorted on, which for a detector with fewer
+/// than 65536 surfaces is at most two passes. The measurements of a
+/// surface keep their input order.
+///
+/// At the same time a table indexed by the surface index of the barcode is
+/// built, so the measurements of a surface are found in O(1) instead of
+/// with a binary search over the collection. Measurements with an invalid
+/// surface link are sorted along, but belong to no surface of the table.
+///
+class measurement_index {
+
+    public:
+    /// An empty index
+    measurement_index() = default;
+
+    /// Sort @c measurements by surface, and index them
+    explicit measurement_index(
+        measurement_collection_types::host& measurements) {
+
+        const std::size_t n = measurements.size();
+        std::vector<std::uint64_t> keys(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            keys[i] = measurements[i].surface_link.value();
+        }
+        std::vector<unsigned int> order, scratch;
+        radix_sort_indices(keys, order, scratch);
+
+        std::vector<measurement> sorted;
+        sorted.reserve(n);
+        for (const unsigned int i : order) {
+            sorted.push_back(measurements[i]);
+        }
+        std::copy(sorted.begin(), sorted.end(), measurements.begin());
+
+        for (unsigned int i = 0; i < n; ++i) {
+            const detray::geometry::barcode barcode =
+                measurements[i].surface_link;
+            // Measurements without a surface stay in the collection, but
+            // are not indexed, instead of sizing the table by the invalid
+            // index.
+            if (barcode.is_invalid()) {
+                continue;
+            }
+            const std::size_t surface = barcode.index();
+            if (surface >= m_ranges.size()) {
+                m_ranges.resize(surface + 1u);
+            }
+            if (i == 0u || barcode != measurements[i - 1u].surface_link) {
+                m_ranges[surface].begin = i;
+            }
+            m_ranges[surface].end = i + 1u;
+        }
+    }
+
+    /// The measurements of the surface with barcode @c barcode
+    measurement_range operator[](detray::geometry::barcode barcode) const {
+        if (barcode.is_invalid()) {
+            return {};
+        }
+        const std::size_t surface = barcode.index();
+        return (surface < m_ranges.size()) ? m_ranges[surface]
+                                           : measurement_range{};
+    }
+
+    /// The range table, indexed by the surface index of the barcode
+    const std::vector<measurement_range>& ranges() const { return m_ranges; }
+
+    private:
+    /// Measurement range of every surface, by surface index
+    std::vector<measurement_range> m_ranges;
+
+};  // class measurement_index
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,95 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <charconv>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace traccc::tutorial {
+
+/// Minimal command line parser for the tutorial executables
+///
+/// Arguments are accepted as @c --name=value or as bare @c --flag. Anything
+/// that is not given on the command line falls back to the default provided
+/// by the caller, so every executable still runs without arguments.
+///
+class options {
+
+    public:
+    /// Parse the command line of an executable
+    options(int argc, char* argv[]) {
+        for (int i = 1; i < argc; ++i) {
+            std::string_view arg{argv[i]};
+            if (arg == "--help" || arg == "-h") {
+                m_help = true;
+                continue;
+            }
+            if (arg.substr(0, 2) != "--") {
+                throw std::invalid_argument("Unknown argument: " +
+                                            std::string{arg});
+            }
+            arg.remove_prefix(2);
+            const auto eq = arg.find('=');
+            if (eq == std::string_view::npos) {
+                m_values.emplace(std::string{arg}, "");
+            } else {
+                m_values.emplace(std::string{arg.substr(0, eq)},
+                                 std::string{arg.substr(eq + 1)});
+            }
+        }
+    }
+
+    /// Whether @c --help was requested
+    bool help() const { return m_help; }
+
+    /// Whether a bare flag (or any value for it) was given
+    bool flag(std::string_view name) const {
+        return m_values.find(name) != m_values.end();
+    }
+
+    /// Get the value of an option, or @c def if it was not given
+    template <typename T>
+    T get(std::string_view name, T def) const {
+        const auto it = m_values.find(name);
+        if (it == m_values.end() || it->second.empty()) {
+            return def;
+        }
+        const std::string& value = it->second;
+        if constexpr (std::is_same_v<T, std::string>) {
+            return value;
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return value == "1" || value == "true" || value == "on";
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return static_cast<T>(std::stod(value));
+        } else {
+            T result{};
+            const auto [ptr, ec] = std::from_chars(
+                value.data(), value.data() + value.size(), result);
+            if (ec != std::errc{} || ptr != value.data() + value.size()) {
+                throw std::invalid_argument("Invalid value for --" +
+                                            std::string{name} + ": " + value);
+            }
+            return result;
+        }
+    }
+
+    private:
+    /// Values of the parsed options
+    std::map<std::string, std::string, std::less<>> m_values;
+    /// Whether the help message was requested
+    bool m_help = false;
+
+};  // class options
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,366 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/radix_sort.hpp"
+#include "common/thread_pool.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/geometry/silicon_detector_description.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of @c parallel_clusterization
+struct parallel_clusterization_config {
+    /// Modules are grouped into tasks of at least this many cells, so that
+    /// the task overhead stays small next to the work of a task
+    std::size_t min_cells_per_task = 4096u;
+};
+
+/// Clusterization of the modules of an event in parallel
+///
+/// Produces the same measurements as @c host::clusterization_algorithm, but
+/// makes use of the modules being independent:
+///
+///  - the cells are ordered by module, with a radix sort if they are not
+///    already, and split into ranges of whole modules;
+///  - every range is one task of a @c thread_pool, which labels the clusters
+///    of its modules and creates their measurements;
+///  - the measurements of the tasks are concatenated in module order, so
+///    the output does not depend on the number of threads.
+///
+/// The labelling walks the cells of a module in row order (sorted by
+/// channel1, then channel0), and only compares a cell with the cell to its
+/// left and the at most three cells above it, found with a pointer that
+/// moves along the previous row. There is no search over earlier cells and
+/// no per-pair branching on the distance, unlike the sparse CCL of traccc.
+///
+class parallel_clusterization {
+
+    public:
+    /// Construct the algorithm
+    ///
+    /// @param mr   Memory resource for the output measurements
+    /// @param pool Thread pool for the tasks; without one, the tasks run on
+    ///             the calling thread
+    /// @param cfg  The algorithm configuration
+    ///
+    explicit parallel_clusterization(
+        vecmem::memory_resource& mr, thread_pool* pool = nullptr,
+        const parallel_clusterization_config& cfg = {})
+        : m_mr(mr), m_pool(pool), m_cfg(cfg) {}
+
+    /// Create the measurements of an event
+    ///
+    /// @param cells_view The cells of the event
+    /// @param dd_view    The detector description
+    /// @return The measurements, ordered by module
+    ///
+    measurement_collection_types::host operator()(
+        const edm::silicon_cell_collection::const_view& cells_view,
+        const silicon_detector_description::const_view& dd_view) const {
+
+        const edm::silicon_cell_collection::const_device cells(cells_view);
+        const silicon_detector_description::const_device dd(dd_view);
+        const unsigned int n_cells = cells.size();
+
+        // Order the cells by module.
+        std::vector<unsigned int> order;
+        const bool module_sorted = [&]() {
+            for (unsigned int i = 1; i < n_cells; ++i) {
+                if (cells.module_index()[i] < cells.module_index()[i - 1]) {
+                    return false;
+                }
+            }
+            return true;
+        }();
+        if (module_sorted) {
+            order.resize(n_cells);
+            std::iota(order.begin(), order.end(), 0u);
+        } else {
+            std::vector<unsigned int> keys(n_cells);
+            for (unsigned int i = 0; i < n_cells; ++i) {
+                keys[i] = cells.module_index()[i];
+            }
+            order = radix_sort_indices(keys);
+        }
+
+        // Split them into tasks of whole modules.
+        std::vector<unsigned int> module_begins;
+        for (unsigned int i = 0; i < n_cells; ++i) {
+            if (i == 0u || cells.module_index()[order[i]] !=
+                               cells.module_index()[order[i - 1]]) {
+                module_begins.push_back(i);
+            }
+        }
+        module_begins.push_back(n_cells);
+        std::vector<std::size_t> task_begins{0u};
+        for (std::size_t m = 1; m + 1u < module_begins.size(); ++m) {
+            if (module_begins[m] - module_begins[task_begins.back()] >=
+                m_cfg.min_cells_per_task) {
+                task_begins.push_back(m);
+            }
+        }
+        task_begins.push_back(module_begins.size() - 1u);
+        const std::size_t n_tasks = task_begins.size() - 1u;
+
+        std::vector<std::vector<measurement>> task_measurements(n_tasks);
+        const auto run_task = [&](std::size_t task, std::size_t) {
+            module_scratch scratch;
+            for (std::size_t m = task_begins[task]; m < task_begins[task + 1u];
+                 ++m) {
+                cluster_module(cells, dd, order, module_begins[m],
+                               module_begins[m + 1u], scratch,
+                               task_measurements[task]);
+            }
+        };
+        if (m_pool != nullptr && n_tasks > 1u) {
+            m_pool->parallel_for(n_tasks, run_task);
+        } else {
+            for (std::size_t task = 0; task < n_tasks; ++task) {
+                run_task(task, 0u);
+            }
+        }
+
+        // Concatenate the measurements of the tasks.
+        std::size_t n_measurements = 0;
+        for (const auto& m : task_measurements) {
+            n_measurements += m.size();
+        }
+        measurement_collection_types::host result{&m_mr};
+        result.reserve(n_measurements);
+        for (const auto& task : task_measurements) {
+            for (const measurement& meas : task) {
+                result.push_back(meas);
+                result.back().measurement_id =
+                    static_cast<unsigned int>(result.size() - 1u);
+            }
+        }
+        return result;
+    }
+
+    private:
+    /// Weighted mean and variance of the cell positions of one cluster
+    ///
+    /// Accumulated with the same weighted Welford algorithm, and the same
+    /// order of cells, as in traccc's measurement creation.
+    ///
+    struct cluster_properties {
+        scalar total_weight = 0.f;
+        scalar offset[2] = {0.f, 0.f};
+        scalar mean[2] = {0.f, 0.f};
+        scalar var[2] = {0.f, 0.f};
+
+        void add(scalar x, scalar y, scalar weight) {
+            if (total_weight == 0.f) {
+                offset[0] = x;
+                offset[1] = y;
+            }
+            total_weight += weight;
+            const scalar weight_factor = weight / total_weight;
+            const scalar pos[2] = {x - offset[0], y - offset[1]};
+            for (int i = 0; i < 2; ++i) {
+                const scalar diff_mean = pos[i] - mean[i];
+                mean[i] += diff_mean * weight_factor;
+                const scalar diff_mean_new = pos[i] - mean[i];
+                var[i] = (1.f - weight_factor) * var[i] +
+                         weight_factor * (diff_mean * diff_mean_new);
+            }
+        }
+    };
+
+    /// Buffers of one task, reused for all of its modules
+    struct module_scratch {
+        std::vector<unsigned int> channel0;
+        std::vector<unsigned int> channel1;
+        std::vector<unsigned int> row_order;
+        std::vector<unsigned int> row_channel0;
+        std::vector<unsigned int> row_channel1;
+        std::vector<unsigned int> label;
+        std::vector<unsigned int> cell_label;
+        std::vector<cluster_properties> clusters;
+    };
+
+    /// Create the measurements of the module with cells
+    /// @c order[begin, end)
+    static void cluster_module(
+        const edm::silicon_cell_collection::const_device& cells,
+        const silicon_detector_description::const_device& dd,
+        const std::vector<unsigned int>& order, unsigned int begin,
+        unsigned int end, module_scratch& scratch,
+        std::vector<measurement>& output) {
+
+        const unsigned int n = end - begin;
+        const unsigned int module = cells.module_index()[order[begin]];
+        scratch.channel0.resize(n);
+        scratch.channel1.resize(n);
+        for (unsigned int k = 0; k < n; ++k) {
+            scratch.channel0[k] = cells.channel0()[order[begin + k]];
+            scratch.channel1[k] = cells.channel1()[order[begin + k]];
+        }
+
+        // Cells in row order. Input from the event generator, and from most
+        // readouts, already is, so the sort is usually skipped.
+        const auto row_less = [&](unsigned int a, unsigned int b) {
+            return (scratch.channel1[a] != scratch.channel1[b])
+                       ? scratch.channel1[a] < scratch.channel1[b]
+                       : scratch.channel0[a] < scratch.channel0[b];
+        };
+        scratch.row_order.resize(n);
+        std::iota(scratch.row_order.begin(), scratch.row_order.end(), 0u);
+        const unsigned int* c0 = scratch.channel0.data();
+        const unsigned int* c1 = scratch.channel1.data();
+        if (!std::is_sorted(scratch.row_order.begin(), scratch.row_order.end(),
+                            row_less)) {
+            std::stable_sort(scratch.row_order.begin(),
+                             scratch.row_order.end(), row_less);
+            scratch.row_channel0.resize(n);
+            scratch.row_channel1.resize(n);
+            for (unsigned int j = 0; j < n; ++j) {
+                scratch.row_channel0[j] =
+                    scratch.channel0[scratch.row_order[j]];
+                scratch.row_channel1[j] =
+                    scratch.channel1[scratch.row_order[j]];
+            }
+            c0 = scratch.row_channel0.data();
+            c1 = scratch.row_channel1.data();
+        }
+
+        scratch.label.resize(n);
+        const unsigned int n_clusters =
+            label_clusters(c0, c1, n, scratch.label.data());
+        scratch.cell_label.resize(n);
+        for (unsigned int j = 0; j < n; ++j) {
+            scratch.cell_label[scratch.row_order[j]] = scratch.label[j];
+        }
+
+        // Accumulate the cluster properties in the input order of the cells.
+        scratch.clusters.assign(n_clusters, cluster_properties{});
+        const scalar threshold = dd.threshold()[module];
+        const scalar pitch_x = dd.pitch_x()[module];
+        const scalar pitch_y = dd.pitch_y()[module];
+        const scalar reference_x = dd.reference_x()[module];
+        const scalar reference_y = dd.reference_y()[module];
+        for (unsigned int k = 0; k < n; ++k) {
+            const scalar weight = cells.activation()[order[begin + k]];
+            if (weight > threshold) {
+                scratch.clusters[scratch.cell_label[k]].add(
+                    reference_x +
+                        (0.5f + static_cast<scalar>(scratch.channel0[k])) *
+                            pitch_x,
+                    reference_y +
+                        (0.5f + static_cast<scalar>(scratch.channel1[k])) *
+                            pitch_y,
+                    weight);
+            }
+        }
+
+        for (const cluster_properties& cluster : scratch.clusters) {
+            if (!(cluster.total_weight > 0.f)) {
+                continue;
+            }
+            measurement meas;
+            meas.local = {cluster.mean[0] + cluster.offset[0],
+                          cluster.mean[1] + cluster.offset[1]};
+            meas.variance = {cluster.var[0] + pitch_x * pitch_x / 12.f,
+                             cluster.var[1] + pitch_y * pitch_y / 12.f};
+            meas.surface_link = dd.geometry_id()[module];
+            meas.meas_dim = dd.dimensions()[module];
+            if (meas.meas_dim == 1u) {
+                meas.local[1] = 0.f;
+            }
+            output.push_back(meas);
+        }
+    }
+
+    /// Label the 8-connected clusters of cells given in row order
+    ///
+    /// @param c0    channel0 of the cells
+    /// @param c1    channel1 of the cells
+    /// @param n     Number of cells
+    /// @param label Output: cluster index of every cell, clusters numbered
+    ///              in the order of their first cell
+    /// @return The number of clusters
+    ///
+    static unsigned int label_clusters(const unsigned int* c0,
+                                       const unsigned int* c1, unsigned int n,
+                                       unsigned int* label) {
+
+        // Union-find over cell indices, with the smallest index as root.
+        // Every neighbour found has a smaller index than the cell itself.
+        const auto find = [label](unsigned int i) {
+            while (label[i] != i) {
+                label[i] = label[label[i]];
+                i = label[i];
+            }
+            return i;
+        };
+        const auto unite = [&](unsigned int root, unsigned int other) {
+            const unsigned int r = find(other);
+            const unsigned int lo = std::min(root, r);
+            label[std::max(root, r)] = lo;
+            return lo;
+        };
+
+        unsigned int row_begin = 0, prev_begin = 0, prev_end = 0, above = 0;
+        for (unsigned int i = 0; i < n; ++i) {
+            label[i] = i;
+            if (i > 0u && c1[i] != c1[i - 1u]) {
+                // Start of a new row; the previous row only counts if it is
+                // adjacent.
+                const bool adjacent = (c1[i] == c1[i - 1u] + 1u);
+                prev_begin = adjacent ? row_begin : i;
+                prev_end = i;
+                row_begin = i;
+                above = prev_begin;
+            }
+            unsigned int root = i;
+            if (i > row_begin && c0[i] - c0[i - 1u] <= 1u) {
+                root = unite(root, i - 1u);
+            }
+            while (above < prev_end && c0[above] + 1u < c0[i]) {
+                ++above;
+            }
+            for (unsigned int j = above; j < prev_end && c0[j] <= c0[i] + 1u;
+                 ++j) {
+                root = unite(root, j);
+            }
+        }
+
+        // Roots precede their cells, so one forward pass numbers the
+        // clusters and resolves every cell to its cluster.
+        unsigned int n_clusters = 0;
+        for (unsigned int i = 0; i < n; ++i) {
+            label[i] = (label[i] == i) ? n_clusters++ : label[label[i]];
+        }
+        return n_clusters;
+    }
+
+    /// Memory resource for the output measurements
+    vecmem::memory_resource& m_mr;
+    /// Thread pool executing the tasks
+    thread_pool* m_pool;
+    /// The algorithm configuration
+    parallel_clusterization_config m_cfg;
+
+};  // class parallel_clusterization
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,153 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/thread_pool.hpp"
+
+// traccc include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/finding/combinatorial_kalman_filter_algorithm.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of @c parallel_track_finding
+struct parallel_track_finding_config {
+    /// Number of seeds per task
+    ///
+    /// The seeds are cut into chunks of this size independently of the
+    /// number of threads, which is what makes the output reproducible.
+    /// Small chunks balance the load better, since the number of branches
+    /// grown from a seed varies a lot.
+    ///
+    std::size_t seeds_per_task = 8u;
+};
+
+/// Combinatorial Kalman filter running the seeds of an event in parallel
+///
+/// The branches grown from different seeds never interact, so the seeds are
+/// cut into fixed-size chunks and every chunk is handed to traccc's host
+/// CKF as one task of a @c thread_pool. Idle workers steal chunks from busy
+/// ones. Every worker uses its own CKF instance and writes the candidates of
+/// a chunk into a buffer of its own; the buffers are concatenated in seed
+/// order at the end.
+///
+/// The candidates found are the same as with one call for all seeds. Their
+/// order is the order of the chunks, so it is the same for any number of
+/// threads.
+///
+class parallel_track_finding {
+
+    public:
+    /// The wrapped track finding algorithm
+    using algorithm_type = host::combinatorial_kalman_filter_algorithm;
+
+    /// Construct the algorithm
+    ///
+    /// @param finding_cfg Configuration of the CKF
+    /// @param mr          Memory resource for the output candidates
+    /// @param pool        Thread pool for the tasks; without one, the tasks
+    ///                    run on the calling thread
+    /// @param cfg         The parallelisation configuration
+    ///
+    parallel_track_finding(const algorithm_type::config_type& finding_cfg,
+                           vecmem::memory_resource& mr,
+                           thread_pool* pool = nullptr,
+                           const parallel_track_finding_config& cfg = {})
+        : m_mr(mr), m_pool(pool), m_cfg(cfg) {
+        // One instance per worker, and one for a caller outside the pool
+        const std::size_t n_instances = (pool != nullptr) ? pool->size() + 1u
+                                                          : 1u;
+        for (std::size_t i = 0; i < n_instances; ++i) {
+            m_finding.push_back(std::make_unique<algorithm_type>(finding_cfg));
+        }
+    }
+
+    /// Find the track candidates of an event
+    ///
+    /// Has the interface of @c host::combinatorial_kalman_filter_algorithm.
+    ///
+    template <typename detector_t, typename field_t>
+    track_candidate_container_types::host operator()(
+        const detector_t& det, const field_t& field,
+        const measurement_collection_types::const_view& measurements,
+        const bound_track_parameters_collection_types::const_view& seeds)
+        const {
+
+        const bound_track_parameters_collection_types::const_device
+            all_seeds(seeds);
+        const std::size_t n_seeds = all_seeds.size();
+        const std::size_t chunk = std::max<std::size_t>(m_cfg.seeds_per_task,
+                                                        1u);
+        const std::size_t n_tasks = (n_seeds + chunk - 1u) / chunk;
+
+        std::vector<track_candidate_container_types::host> task_candidates(
+            n_tasks);
+        const auto run_task = [&](std::size_t task, std::size_t worker) {
+            // Not from m_mr: that may be a single-threaded arena.
+            bound_track_parameters_collection_types::host task_seeds;
+            const std::size_t end = std::min(n_seeds, (task + 1u) * chunk);
+            for (std::size_t i = task * chunk; i < end; ++i) {
+                task_seeds.push_back(all_seeds.at(static_cast<unsigned int>(i)));
+            }
+            task_candidates[task] =
+                (*m_finding[std::min(worker, m_finding.size() - 1u)])(
+                    det, field, measurements, vecmem::get_data(task_seeds));
+        };
+        if (m_pool != nullptr && n_tasks > 1u) {
+            m_pool->parallel_for(n_tasks, run_task);
+        } else {
+            for (std::size_t task = 0; task < n_tasks; ++task) {
+                run_task(task, m_finding.size() - 1u);
+            }
+        }
+
+        // Concatenate the candidates of the tasks, in seed order.
+        std::size_t n_candidates = 0;
+        for (const auto& candidates : task_candidates) {
+            n_candidates += candidates.size();
+        }
+        track_candidate_container_types::host result{&m_mr};
+        result.resize(n_candidates);
+        std::size_t index = 0;
+        for (const auto& candidates : task_candidates) {
+            for (std::size_t i = 0; i < candidates.size(); ++i, ++index) {
+                result.at(index).header = candidates.at(i).header;
+                for (const measurement& meas : candidates.at(i).items) {
+                    result.at(index).items.push_back(meas);
+                }
+            }
+        }
+        return result;
+    }
+
+    private:
+    /// Memory resource for the output candidates, used on the calling
+    /// thread only
+    vecmem::memory_resource& m_mr;
+    /// Thread pool executing the tasks
+    thread_pool* m_pool;
+    /// The parallelisation configuration
+    parallel_track_finding_config m_cfg;
+    /// CKF instance of every worker
+    std::vector<std::unique_ptr<algorithm_type>> m_finding;
+
+};  // class parallel_track_finding
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,247 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/bounded_queue.hpp"
+
+// System include(s).
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Stages of the pipelined execution, in the order in which events pass them
+enum class pipeline_stage : std::size_t {
+    read = 0,
+    clusterization,
+    seeding,
+    track_finding,
+    track_fitting,
+    write,
+    n_stages
+};
+
+/// Number of stages in the pipelined execution
+inline constexpr std::size_t n_pipeline_stages =
+    static_cast<std::size_t>(pipeline_stage::n_stages);
+
+/// Printable name of a pipeline stage
+inline constexpr std::string_view pipeline_stage_name(pipeline_stage s) {
+    constexpr std::array<std::string_view, n_pipeline_stages> names{
+        "read",          "clusterization", "seeding",
+        "track_finding", "track_fitting",  "write"};
+    return names[static_cast<std::size_t>(s)];
+}
+
+/// Configuration of the pipelined execution
+struct pipeline_config {
+    /// Number of threads of every stage
+    std::array<std::size_t, n_pipeline_stages> threads{1u, 1u, 1u,
+                                                       1u, 1u, 1u};
+    /// Capacity of the queue behind every stage
+    ///
+    /// A stage that gets this far ahead of the next one waits, so at most
+    /// about (capacity + threads) events per stage are in memory at a time.
+    ///
+    std::size_t queue_capacity = 4u;
+
+    /// Threads for a total of @c n_threads
+    ///
+    /// One thread reads and one writes, and the rest are shared by the
+    /// compute stages, with the remainder going to track finding.
+    ///
+    /// @throw std::invalid_argument if @c n_threads is smaller than the
+    ///        number of stages
+    ///
+    static pipeline_config for_threads(std::size_t n_threads) {
+        if (n_threads < n_pipeline_stages) {
+            throw std::invalid_argument(
+                "The pipeline needs at least one thread per stage (" +
+                std::to_string(n_pipeline_stages) + "), got " +
+                std::to_string(n_threads));
+        }
+        pipeline_config cfg;
+        const std::size_t compute = n_threads - 2u;
+        for (std::size_t s = 1u; s <= 4u; ++s) {
+            cfg.threads[s] = compute / 4u;
+        }
+        cfg.threads[static_cast<std::size_t>(pipeline_stage::track_finding)] +=
+            compute % 4u;
+        return cfg;
+    }
+
+    /// Parse the thread counts from a comma separated list, e.g. "1,2,2,4,2,1"
+    static std::array<std::size_t, n_pipeline_stages> parse_threads(
+        const std::string& list) {
+        std::array<std::size_t, n_pipeline_stages> result{};
+        std::istringstream in(list);
+        std::string item;
+        std::size_t i = 0;
+        for (; std::getline(in, item, ','); ++i) {
+            if (i >= n_pipeline_stages) {
+                break;
+            }
+            result[i] = std::stoul(item);
+            if (result[i] == 0u) {
+                throw std::invalid_argument(
+                    "Every pipeline stage needs at least one thread");
+            }
+        }
+        if (i != n_pipeline_stages) {
+            throw std::invalid_argument(
+                "Expected " + std::to_string(n_pipeline_stages) +
+                " comma separated pipeline thread counts, got \"" + list +
+                "\"");
+        }
+        return result;
+    }
+};
+
+/// The first failure of any stage of a pipeline
+///
+/// Stage threads record their exceptions here instead of letting them
+/// escape. The first one runs the failure action, which typically closes
+/// all queues of the pipeline, so that every stage stops instead of waiting
+/// for a stage that is gone. @c rethrow() then reports it, once the stages
+/// were joined.
+///
+class pipeline_failure {
+
+    public:
+    /// Construct with the action to run on the first failure
+    explicit pipeline_failure(std::function<void()> on_failure)
+        : m_on_failure(std::move(on_failure)) {}
+
+    pipeline_failure(const pipeline_failure&) = delete;
+    pipeline_failure& operator=(const pipeline_failure&) = delete;
+
+    /// Record an exception of a stage thread
+    void record(std::exception_ptr error) {
+        {
+            std::lock_guard lock{m_mutex};
+            if (m_error) {
+                return;
+            }
+            m_error = std::move(error);
+        }
+        m_on_failure();
+    }
+
+    /// Rethrow the first recorded exception, if there was one
+    void rethrow() const {
+        std::lock_guard lock{m_mutex};
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+    private:
+    /// Run on the first failure
+    std::function<void()> m_on_failure;
+    /// Guards @c m_error
+    mutable std::mutex m_mutex;
+    /// The first recorded exception
+    std::exception_ptr m_error;
+
+};  // class pipeline_failure
+
+/// The threads running one stage of a pipeline
+///
+/// Every thread runs the same body. When the last of them returns, the
+/// completion action runs, which typically closes the queue to the next
+/// stage, so that the threads of that stage stop once they drained it. An
+/// exception of the body is recorded in the pipeline's @c pipeline_failure,
+/// and the thread then finishes like one whose body returned.
+///
+class stage_group {
+
+    public:
+    /// Start the threads
+    ///
+    /// @param n_threads Number of threads
+    /// @param body      Called as @c body(thread_index) on every thread
+    /// @param on_done   Called once, after the last thread left @c body
+    /// @param failure   Where the exceptions of @c body go
+    ///
+    template <typename body_t, typename done_t>
+    stage_group(std::size_t n_threads, body_t body, done_t on_done,
+                pipeline_failure& failure) {
+        auto remaining = std::make_shared<std::atomic<std::size_t>>(n_threads);
+        for (std::size_t i = 0; i < n_threads; ++i) {
+            m_threads.emplace_back([i, body, on_done, remaining, &failure]() {
+                try {
+                    body(i);
+                } catch (...) {
+                    failure.record(std::current_exception());
+                }
+                if (remaining->fetch_sub(1u, std::memory_order_acq_rel) ==
+                    1u) {
+                    on_done();
+                }
+            });
+        }
+    }
+
+    stage_group(stage_group&&) = default;
+    stage_group& operator=(stage_group&&) = default;
+
+    /// Wait for the threads
+    ~stage_group() { join(); }
+
+    /// Wait for the threads
+    void join() {
+        for (auto& thread : m_threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+
+    private:
+    std::vector<std::thread> m_threads;
+
+};  // class stage_group
+
+/// Start a stage that transforms the elements of one queue into the next
+///
+/// Every thread takes elements from @c in, calls @c fn(element,
+/// thread_index) on them and pushes them to @c out. @c out is closed once
+/// @c in is closed and drained, or once @c out refuses elements because it
+/// was closed after a failure.
+///
+template <typename T, typename fn_t>
+stage_group transform_stage(std::size_t n_threads, bounded_queue<T>& in,
+                            bounded_queue<T>& out, fn_t fn,
+                            pipeline_failure& failure) {
+    return stage_group(
+        n_threads,
+        [&in, &out, fn](std::size_t thread) {
+            while (auto element = in.pop()) {
+                fn(*element, thread);
+                if (!out.push(std::move(*element))) {
+                    return;
+                }
+            }
+        },
+        [&out]() { out.close(); }, failure);
+}
+
+}  // namespace traccc::tutorial
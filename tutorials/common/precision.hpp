@@ -0,0 +1,35 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <string_view>
+
+namespace traccc::tutorial {
+
+// The precision is selected with the TUTORIAL_PRECISION CMake option. The
+// "float" and "mixed" builds build traccc and detray with float scalars. The
+// "mixed" build fits the tracks with the batched fitter, which always works
+// in double precision: in float, its smoothed covariances lose positive
+// definiteness for a large fraction of the tracks. Comparisons of the
+// precisions should therefore select the fitter explicitly, as
+// scripts/compare_precision.py does.
+#if defined(TUTORIAL_PRECISION_FLOAT)
+/// Name of the precision of the build
+inline constexpr std::string_view precision_name = "float";
+/// Whether the chain fits with the batched fitter by default
+inline constexpr bool default_batched_fitting = false;
+#elif defined(TUTORIAL_PRECISION_MIXED)
+inline constexpr std::string_view precision_name = "mixed";
+inline constexpr bool default_batched_fitting = true;
+#else
+inline constexpr std::string_view precision_name = "double";
+inline constexpr bool default_batched_fitting = false;
+#endif
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,315 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// traccc include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/seed.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/edm/spacepoint.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// System include(s).
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// POSIX include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace traccc::tutorial {
+
+/// 64-bit FNV-1a hash of bytes and of trivially copyable objects
+class product_hasher {
+
+    public:
+    /// Hash @c size bytes
+    product_hasher& add_bytes(const void* ptr, std::size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(ptr);
+        for (std::size_t i = 0; i < size; ++i) {
+            m_value = (m_value ^ bytes[i]) * 0x100000001b3ull;
+        }
+        return *this;
+    }
+
+    /// Hash the bytes of an object, without its padding where the compiler
+    /// allows to clear it
+    ///
+    /// Without @c __builtin_clear_padding, padding bytes are hashed as
+    /// they are. That can only make equal objects hash differently (a
+    /// spurious cache miss), never different objects equally.
+    ///
+    template <typename T>
+    product_hasher& add(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Only trivially copyable objects can be hashed");
+        T copy = value;
+#ifdef __has_builtin
+#if __has_builtin(__builtin_clear_padding)
+        __builtin_clear_padding(&copy);
+#endif
+#endif
+        return add_bytes(&copy, sizeof(T));
+    }
+
+    /// The hash value
+    std::uint64_t value() const { return m_value; }
+
+    private:
+    std::uint64_t m_value = 0xcbf29ce484222325ull;
+
+};  // class product_hasher
+
+namespace details {
+
+/// Number of cached collections
+inline constexpr std::size_t n_cached_products = 4u;
+
+/// Element sizes of the cached collections, to refuse files of another
+/// build
+inline constexpr std::array<std::uint32_t, n_cached_products>
+    cached_product_sizes{sizeof(measurement), sizeof(spacepoint),
+                         sizeof(seed), sizeof(bound_track_parameters)};
+
+/// Alignment of the collections in a cache file
+inline constexpr std::size_t product_file_alignment = 64u;
+
+/// Round @c value up to the collection alignment
+inline constexpr std::uint64_t product_align_up(std::uint64_t value) {
+    return (value + product_file_alignment - 1u) &
+           ~(product_file_alignment - 1u);
+}
+
+/// Header at the start of a cache file
+struct product_file_header {
+    /// File identifier
+    char magic[8];
+    /// Hash of the upstream configuration
+    std::uint64_t config_hash;
+    /// Key of the event (input and configuration)
+    std::uint64_t key;
+    /// Offset and size of every collection
+    std::array<std::uint64_t, n_cached_products> offsets;
+    std::array<std::uint64_t, n_cached_products> sizes;
+    /// Element size of every collection
+    std::array<std::uint32_t, n_cached_products> element_sizes;
+};
+
+/// Magic bytes of a cache file
+inline constexpr char product_file_magic[8] = {'T', 'U', 'T', 'P',
+                                               'R', 'O', 'D', '1'};
+
+}  // namespace details
+
+/// On-disk cache of the products of clusterization and seeding
+///
+/// Clusterization, spacepoint formation, seeding and track parameter
+/// estimation only depend on the cells of an event and on their own
+/// configuration. While the track finding and fitting configurations are
+/// tuned, their products can therefore be reused. The cache keeps one file
+/// per event in a directory, named after a key that hashes the cells with
+/// the configuration of the upstream stages (given to the constructor as
+/// one hash). Runs with other inputs or upstream configurations use other
+/// keys, so they can share the directory.
+///
+/// A file holds the measurements, spacepoints, seeds and track parameters,
+/// as 64-byte aligned arrays. Loading maps the file and copies the arrays
+/// into the event's collections; they are not used in place, since track
+/// finding sorts the measurements. Files are written under a temporary name
+/// and renamed, so concurrent runs and threads never see partial files.
+///
+class product_cache {
+
+    public:
+    /// Use the cache in @c directory, creating it if needed
+    ///
+    /// @param directory   The cache directory
+    /// @param config_hash Hash of the upstream configuration
+    ///
+    product_cache(const std::string& directory, std::uint64_t config_hash)
+        : m_directory(directory), m_config_hash(config_hash) {
+        std::filesystem::create_directories(m_directory);
+    }
+
+    /// Key of the event with the given cells
+    std::uint64_t key(
+        const edm::silicon_cell_collection::const_view& cells) const {
+        const edm::silicon_cell_collection::const_device device(cells);
+        product_hasher hasher;
+        hasher.add(m_config_hash).add(device.size());
+        for (unsigned int i = 0; i < device.size(); ++i) {
+            hasher.add(device.channel0()[i])
+                .add(device.channel1()[i])
+                .add(device.activation()[i])
+                .add(device.time()[i])
+                .add(device.module_index()[i]);
+        }
+        return hasher.value();
+    }
+
+    /// Load the products of an event, if they are in the cache
+    ///
+    /// The products are copied into the given collections, on their own
+    /// memory resource.
+    ///
+    /// @return @c false, with the collections unchanged, on a cache miss
+    ///
+    bool load(std::uint64_t key,
+              measurement_collection_types::host& measurements,
+              spacepoint_collection_types::host& spacepoints,
+              seed_collection_types::host& seeds,
+              bound_track_parameters_collection_types::host& params) const {
+
+        const int fd = ::open(path(key).c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        const auto size = static_cast<std::size_t>(st.st_size);
+        void* ptr = (size >= sizeof(details::product_file_header))
+                        ? ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0)
+                        : MAP_FAILED;
+        ::close(fd);
+        if (ptr == MAP_FAILED) {
+            return false;
+        }
+        const auto* data = static_cast<const std::byte*>(ptr);
+        const auto& header =
+            *reinterpret_cast<const details::product_file_header*>(data);
+
+        bool valid =
+            std::memcmp(header.magic, details::product_file_magic,
+                        sizeof(header.magic)) == 0 &&
+            header.config_hash == m_config_hash && header.key == key &&
+            header.element_sizes == details::cached_product_sizes;
+        // Written so that a corrupt header can not overflow the check
+        for (std::size_t i = 0; valid && i < details::n_cached_products;
+             ++i) {
+            valid = header.offsets[i] <= size &&
+                    header.sizes[i] <= (size - header.offsets[i]) /
+                                           details::cached_product_sizes[i];
+        }
+        if (valid) {
+            copy(data, header, 0u, measurements);
+            copy(data, header, 1u, spacepoints);
+            copy(data, header, 2u, seeds);
+            copy(data, header, 3u, params);
+        }
+        ::munmap(ptr, size);
+        return valid;
+    }
+
+    /// Store the products of an event
+    void store(std::uint64_t key,
+               const measurement_collection_types::host& measurements,
+               const spacepoint_collection_types::host& spacepoints,
+               const seed_collection_types::host& seeds,
+               const bound_track_parameters_collection_types::host& params)
+        const {
+
+        details::product_file_header header{};
+        std::memcpy(header.magic, details::product_file_magic,
+                    sizeof(header.magic));
+        header.config_hash = m_config_hash;
+        header.key = key;
+        header.element_sizes = details::cached_product_sizes;
+        header.sizes = {measurements.size(), spacepoints.size(),
+                        seeds.size(), params.size()};
+        std::uint64_t offset =
+            details::product_align_up(sizeof(details::product_file_header));
+        for (std::size_t i = 0; i < details::n_cached_products; ++i) {
+            header.offsets[i] = offset;
+            offset = details::product_align_up(
+                offset + header.sizes[i] * details::cached_product_sizes[i]);
+        }
+
+        // A unique temporary file, also between processes sharing the
+        // directory, that is renamed into place once it is complete
+        const std::string final_path = path(key);
+        std::string temporary_path = final_path + ".tmpXXXXXX";
+        const int fd = ::mkstemp(temporary_path.data());
+        if (fd < 0) {
+            throw std::runtime_error("Could not create a temporary file for " +
+                                     final_path + ": " +
+                                     std::strerror(errno));
+        }
+        ::fchmod(fd, 0644);
+        ::close(fd);
+        {
+            std::ofstream out(temporary_path,
+                              std::ios::binary | std::ios::trunc);
+            const auto write_at = [&out](std::uint64_t at, const void* ptr,
+                                         std::size_t bytes) {
+                out.seekp(static_cast<std::streamoff>(at));
+                out.write(static_cast<const char*>(ptr),
+                          static_cast<std::streamsize>(bytes));
+            };
+            write_at(0u, &header, sizeof(header));
+            write_at(header.offsets[0], measurements.data(),
+                     measurements.size() * sizeof(measurement));
+            write_at(header.offsets[1], spacepoints.data(),
+                     spacepoints.size() * sizeof(spacepoint));
+            write_at(header.offsets[2], seeds.data(),
+                     seeds.size() * sizeof(seed));
+            write_at(header.offsets[3], params.data(),
+                     params.size() * sizeof(bound_track_parameters));
+            if (!out) {
+                out.close();
+                std::remove(temporary_path.c_str());
+                throw std::runtime_error("Could not write " + temporary_path);
+            }
+        }
+        std::filesystem::rename(temporary_path, final_path);
+    }
+
+    private:
+    /// File of the event with key @c key
+    std::string path(std::uint64_t key) const {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin",
+                      static_cast<unsigned long long>(key));
+        return (m_directory / name).string();
+    }
+
+    /// Copy collection @c i of a mapped file
+    template <typename collection_t>
+    static void copy(const std::byte* data,
+                     const details::product_file_header& header,
+                     std::size_t i, collection_t& collection) {
+        using value_type = typename collection_t::value_type;
+        static_assert(std::is_trivially_copyable_v<value_type>);
+        collection.resize(header.sizes[i]);
+        std::memcpy(static_cast<void*>(collection.data()),
+                    data + header.offsets[i],
+                    header.sizes[i] * sizeof(value_type));
+    }
+
+    /// The cache directory
+    std::filesystem::path m_directory;
+    /// Hash of the upstream configuration
+    std::uint64_t m_config_hash;
+
+};  // class product_cache
+
+}  // namespace traccc::tutorial
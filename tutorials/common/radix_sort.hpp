@@ -0,0 +1,82 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Stable LSD radix sort of indices by unsigned integer keys
+///
+/// Sorts @c order, the indices 0 .. keys.size()-1, by @c keys[index], one
+/// byte per pass. The histograms of all bytes are built in a single pass
+/// over the keys, and passes over bytes that are the same in every key (the
+/// high bytes of small module indices, the unused fields of a barcode) are
+/// skipped. Equal keys keep their original order.
+///
+/// @param keys    The keys to sort by
+/// @param order   Output: the sorted indices
+/// @param scratch Buffer of the same kind, reused between calls
+///
+template <typename key_t>
+void radix_sort_indices(const std::vector<key_t>& keys,
+                        std::vector<unsigned int>& order,
+                        std::vector<unsigned int>& scratch) {
+
+    static_assert(std::is_unsigned_v<key_t>,
+                  "Radix sort keys must be unsigned integers");
+    constexpr std::size_t n_digits = sizeof(key_t);
+
+    const std::size_t n = keys.size();
+    order.resize(n);
+    std::iota(order.begin(), order.end(), 0u);
+    if (n < 2u) {
+        return;
+    }
+    scratch.resize(n);
+
+    std::array<std::array<std::size_t, 256>, n_digits> counts{};
+    for (const key_t key : keys) {
+        for (std::size_t d = 0; d < n_digits; ++d) {
+            ++counts[d][(key >> (8u * d)) & 0xffu];
+        }
+    }
+
+    for (std::size_t d = 0; d < n_digits; ++d) {
+        auto& count = counts[d];
+        const unsigned int shift = 8u * static_cast<unsigned int>(d);
+        if (count[(keys[0] >> shift) & 0xffu] == n) {
+            continue;
+        }
+        std::size_t offset = 0;
+        for (std::size_t& c : count) {
+            const std::size_t size = c;
+            c = offset;
+            offset += size;
+        }
+        for (const unsigned int index : order) {
+            scratch[count[(keys[index] >> shift) & 0xffu]++] = index;
+        }
+        order.swap(scratch);
+    }
+}
+
+/// Stable LSD radix sort of indices by unsigned integer keys
+template <typename key_t>
+std::vector<unsigned int> radix_sort_indices(const std::vector<key_t>& keys) {
+    std::vector<unsigned int> order, scratch;
+    radix_sort_indices(keys, order, scratch);
+    return order;
+}
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,493 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/adaptive_fitting.hpp"
+#include "common/ambiguity_resolution.hpp"
+#include "common/batched_kalman_fitter.hpp"
+#include "common/detector_utils.hpp"
+#include "common/grid_seeding.hpp"
+#include "common/instrumentation.hpp"
+#include "common/measurement_index.hpp"
+#include "common/parallel_clusterization.hpp"
+#include "common/parallel_track_finding.hpp"
+#include "common/precision.hpp"
+#include "common/product_cache.hpp"
+#include "common/stage_timer.hpp"
+#include "common/telescope_track_finding.hpp"
+#include "common/thread_pool.hpp"
+
+// traccc include(s).
+#include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/finding/combinatorial_kalman_filter_algorithm.hpp"
+#include "traccc/fitting/kalman_fitting_algorithm.hpp"
+#include "traccc/geometry/detector.hpp"
+#include "traccc/geometry/silicon_detector_description.hpp"
+#include "traccc/seeding/seeding_algorithm.hpp"
+#include "traccc/seeding/silicon_pixel_spacepoint_formation_algorithm.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+
+// detray include(s).
+#include "detray/detectors/bfield.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of every algorithm in the reconstruction chain
+struct chain_config {
+
+    /// Magnetic field used by seeding, finding and fitting
+    vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+
+    /// Clusterize with @c parallel_clusterization instead of traccc's
+    /// clusterization algorithm
+    bool use_parallel_clusterization = false;
+    /// Configuration of the parallel clusterization
+    parallel_clusterization_config parallel_clusterization;
+
+    /// @name Seeding configuration
+    /// @{
+    seedfinder_config finder;
+    spacepoint_grid_config grid{finder};
+    seedfilter_config filter;
+    /// Seed with @c grid_seeding instead of traccc's seeding algorithm
+    bool use_grid_seeding = false;
+    /// Configuration of the grid seeding
+    grid_seeding_config grid_seeding;
+    /// @}
+
+    /// Track finding configuration
+    host::combinatorial_kalman_filter_algorithm::config_type finding;
+    /// Find tracks with @c parallel_track_finding, seeds spread over the
+    /// chain's thread pool
+    bool use_parallel_finding = false;
+    /// Configuration of the parallel track finding
+    parallel_track_finding_config parallel_finding;
+    /// Find tracks with @c telescope_track_finding instead of traccc's CKF
+    bool use_telescope_finding = false;
+    /// Configuration of the telescope track finding
+    telescope_finding_config telescope_finding;
+    /// Remove track candidates that share measurements before the fit
+    bool use_ambiguity_resolution = false;
+    /// Configuration of the ambiguity resolution
+    ambiguity_resolution_config ambiguity_resolution;
+    /// Track fitting configuration
+    fitting_config fitting;
+    /// Refit the tracks with @c adaptive_kalman_fitting until they converge,
+    /// instead of @c fitting.n_iterations times
+    bool use_adaptive_fitting = false;
+    /// Configuration of the adaptive fitting
+    adaptive_fitting_config adaptive_fitting;
+    /// Fit the tracks with @c batched_kalman_fitter instead of traccc's
+    /// Kalman fitter
+    bool use_batched_fitter = default_batched_fitting;
+    /// Configuration of the batched fitter
+    batched_fitter_config batched_fitting;
+    /// Have the telescope track finding hand its forward filter states to
+    /// the batched fitter, which then only smooths them
+    bool use_filtered_smoothing = false;
+
+    /// Directory of the on-disk cache of the clusterization and seeding
+    /// products; empty for no cache
+    std::string product_cache;
+
+    /// Default configuration, matching the single-stage tutorials
+    chain_config() {
+        finder.bFieldInZ = B[2];
+        grid = spacepoint_grid_config{finder};
+
+        finding.propagation.stepping.rk_error_tol = 1e-8f * unit<float>::mm;
+        finding.min_track_candidates_per_track = 3;
+
+        fitting.propagation.stepping.rk_error_tol = 1e-8f * unit<float>::mm;
+        fitting.use_backward_filter = true;
+    }
+
+};  // struct chain_config
+
+/// Products of the reconstruction chain for one event
+///
+/// The collections are created on the memory resource of the chain, so the
+/// outputs of the algorithms, which use the same resource, are moved into
+/// them without a copy.
+///
+struct chain_result {
+
+    /// Products allocated from @c mr
+    explicit chain_result(vecmem::memory_resource& mr)
+        : measurements(&mr),
+          spacepoints(&mr),
+          seeds(&mr),
+          params(&mr),
+          track_candidates(&mr),
+          track_states(&mr) {}
+
+    measurement_collection_types::host measurements;
+    /// Per-surface ranges of @c measurements, once they are sorted for track
+    /// finding
+    measurement_index measurement_ranges;
+    spacepoint_collection_types::host spacepoints;
+    seed_collection_types::host seeds;
+    bound_track_parameters_collection_types::host params;
+    track_candidate_container_types::host track_candidates;
+    track_state_container_types::host track_states;
+    /// Fitted tracks, if the chain uses the batched fitter
+    std::vector<batched_fit_result<double>> batched_track_states;
+    /// Fit iterations of the tracks, if the chain uses the adaptive fitting
+    iteration_histogram fit_iterations;
+    /// Forward filter states of @c track_candidates, if the track finding
+    /// hands them to the fitter
+    std::vector<filtered_track<double>> filtered_tracks;
+    /// Key of the event in the product cache, if the chain uses one
+    std::uint64_t product_key = 0u;
+    /// Whether the products up to the track parameters came from the cache
+    bool from_cache = false;
+};
+
+/// The full host reconstruction chain, from cells to fitted tracks
+///
+/// The chain owns one instance of every algorithm, constructed once and
+/// reused for every event passed to @c operator().
+///
+class reconstruction_chain {
+
+    public:
+    /// Detector type the chain operates on
+    using detector_type = traccc::default_detector::host;
+    /// Magnetic field type the chain operates on
+    using field_type = detray::bfield::const_field_t;
+    /// Batched fitter type; 8 doubles fill an AVX-512 register (or two AVX2
+    /// registers)
+    using batched_fitter_type = batched_kalman_fitter<8u, double>;
+
+    /// Construct the chain
+    ///
+    /// @param cfg   Configuration of the algorithms
+    /// @param det   The (shared, read-only) tracking geometry
+    /// @param dd    The (shared, read-only) detector description
+    /// @param field The (shared, read-only) magnetic field
+    /// @param mr    Memory resource for the event data products
+    /// @param pool  Thread pool for the parallel clusterization, seeding and
+    ///              track finding, if any
+    ///
+    reconstruction_chain(const chain_config& cfg, const detector_type& det,
+                         const silicon_detector_description::host& dd,
+                         const field_type& field, vecmem::memory_resource& mr,
+                         thread_pool* pool = nullptr)
+        : m_cfg(cfg),
+          m_det(det),
+          m_dd(dd),
+          m_field(field),
+          m_mr(mr),
+          m_clusterization(mr),
+          m_spacepoint_formation(mr),
+          m_seeding(cfg.finder, cfg.grid, cfg.filter, mr),
+          m_track_params_estimation(mr),
+          m_finding(cfg.finding),
+          m_fitting(cfg.fitting, mr) {
+        if (cfg.use_parallel_clusterization) {
+            m_parallel_clusterization.emplace(mr, pool,
+                                              cfg.parallel_clusterization);
+        }
+        if (cfg.use_grid_seeding) {
+            m_grid_seeding.emplace(cfg.grid_seeding, sensitive_modules(det),
+                                   cfg.B, mr, pool);
+        }
+        if (!cfg.product_cache.empty()) {
+            m_product_cache.emplace(cfg.product_cache,
+                                    upstream_hash(cfg, det, dd));
+        }
+        if (cfg.use_filtered_smoothing &&
+            !(cfg.use_telescope_finding && cfg.use_batched_fitter)) {
+            throw std::invalid_argument(
+                "Smoothing handed over filter states needs the telescope "
+                "track finding and the batched fitter");
+        }
+        if (cfg.use_telescope_finding) {
+            m_telescope_finding.emplace(cfg.telescope_finding,
+                                        cfg.batched_fitting,
+                                        sensitive_modules(det), cfg.B, mr);
+        }
+        if (cfg.use_ambiguity_resolution) {
+            m_ambiguity_resolution.emplace(cfg.ambiguity_resolution, mr);
+        }
+        if (cfg.use_parallel_finding) {
+            m_parallel_finding.emplace(cfg.finding, mr, pool,
+                                       cfg.parallel_finding);
+        }
+        if (cfg.use_adaptive_fitting) {
+            m_adaptive_fitting.emplace(cfg.fitting, cfg.adaptive_fitting, mr);
+        }
+        if (cfg.use_batched_fitter) {
+            m_batched_fitting.emplace(cfg.batched_fitting,
+                                      sensitive_modules(det), cfg.B);
+        }
+    }
+
+    /// Reconstruct one event
+    ///
+    /// @param cells The cells of the event
+    /// @param times Stage times to add the timing of this event to
+    /// @return The products of all stages
+    ///
+    chain_result operator()(const edm::silicon_cell_collection::host& cells,
+                            stage_times& times) const {
+        return (*this)(vecmem::get_data(cells), times);
+    }
+
+    /// Reconstruct one event, reading the cells through a view
+    ///
+    /// @param cells View of the cells of the event, e.g. into a mapped file
+    /// @param times Stage times to add the timing of this event to
+    /// @return The products of all stages
+    ///
+    chain_result operator()(
+        const edm::silicon_cell_collection::const_view& cells,
+        stage_times& times) const {
+
+        chain_result result = make_result();
+        clusterize(cells, result, times);
+        seed(result, times);
+        find_tracks(result, times);
+        fit_tracks(result, times);
+        TUTORIAL_COUNT(events, 1);
+        return result;
+    }
+
+    /// Empty products of an event, on the memory resource of the chain
+    chain_result make_result() const { return chain_result{m_mr}; }
+
+    /// @name Groups of stages, as run one after another by @c operator()
+    ///
+    /// A pipelined execution can run them on different threads, passing
+    /// the @c chain_result of an event from one group to the next. Every
+    /// group only uses the algorithms of its own stages. The result has to
+    /// come from @c make_result() of a chain on the same memory resource.
+    ///
+    /// @{
+
+    /// Clusterization and spacepoint formation
+    ///
+    /// With a product cache, an event found in it gets all products up to
+    /// the track parameters here, in the clusterization time, and @c seed
+    /// does nothing for it.
+    ///
+    void clusterize(const edm::silicon_cell_collection::const_view& cells,
+                    chain_result& result, stage_times& times) const {
+        if (m_product_cache) {
+            scoped_stage_timer t{times, stage::clusterization};
+            result.product_key = m_product_cache->key(cells);
+            result.from_cache = m_product_cache->load(
+                result.product_key, result.measurements, result.spacepoints,
+                result.seeds, result.params);
+        }
+        if (result.from_cache) {
+            TUTORIAL_COUNT(product_cache_hits, 1);
+            TUTORIAL_COUNT(measurements, result.measurements.size());
+            TUTORIAL_COUNT(spacepoints, result.spacepoints.size());
+            TUTORIAL_COUNT(seeds, result.seeds.size());
+            return;
+        }
+        {
+            scoped_stage_timer t{times, stage::clusterization};
+            result.measurements =
+                m_parallel_clusterization
+                    ? (*m_parallel_clusterization)(cells,
+                                                   vecmem::get_data(m_dd))
+                    : m_clusterization(cells, vecmem::get_data(m_dd));
+        }
+        {
+            scoped_stage_timer t{times, stage::spacepoint_formation};
+            result.spacepoints = m_spacepoint_formation(
+                m_det, vecmem::get_data(result.measurements));
+        }
+        TUTORIAL_COUNT(measurements, result.measurements.size());
+        TUTORIAL_COUNT(spacepoints, result.spacepoints.size());
+    }
+
+    /// Seeding and track parameter estimation
+    void seed(chain_result& result, stage_times& times) const {
+        if (result.from_cache) {
+            return;
+        }
+        {
+            scoped_stage_timer t{times, stage::seeding};
+            result.seeds = m_grid_seeding
+                               ? (*m_grid_seeding)(result.spacepoints)
+                               : m_seeding(result.spacepoints);
+        }
+        {
+            scoped_stage_timer t{times, stage::track_params_estimation};
+            result.params = m_track_params_estimation(
+                result.spacepoints, result.seeds, m_cfg.B);
+        }
+        TUTORIAL_COUNT(seeds, result.seeds.size());
+        if (m_product_cache) {
+            TUTORIAL_COUNT(product_cache_misses, 1);
+            m_product_cache->store(result.product_key, result.measurements,
+                                   result.spacepoints, result.seeds,
+                                   result.params);
+        }
+    }
+
+    /// Track finding
+    void find_tracks(chain_result& result, stage_times& times) const {
+        {
+            scoped_stage_timer t{times, stage::track_finding};
+            // Measurements need to be sorted w.r.t. geometry barcode
+            result.measurement_ranges = measurement_index(result.measurements);
+            if (m_telescope_finding) {
+                result.track_candidates = (*m_telescope_finding)(
+                    result.measurements, result.measurement_ranges,
+                    result.params,
+                    m_cfg.use_filtered_smoothing ? &result.filtered_tracks
+                                                 : nullptr);
+            } else if (m_parallel_finding) {
+                result.track_candidates = (*m_parallel_finding)(
+                    m_det, m_field, vecmem::get_data(result.measurements),
+                    vecmem::get_data(result.params));
+            } else {
+                result.track_candidates =
+                    m_finding(m_det, m_field,
+                              vecmem::get_data(result.measurements),
+                              vecmem::get_data(result.params));
+            }
+            if (m_ambiguity_resolution) {
+                std::vector<std::size_t> kept;
+                result.track_candidates = (*m_ambiguity_resolution)(
+                    result.track_candidates, &kept);
+                if (m_cfg.use_filtered_smoothing) {
+                    // Keep the handed over states in step with the candidates
+                    for (std::size_t i = 0; i < kept.size(); ++i) {
+                        if (kept[i] != i) {
+                            result.filtered_tracks[i] =
+                                std::move(result.filtered_tracks[kept[i]]);
+                        }
+                    }
+                    result.filtered_tracks.resize(kept.size());
+                }
+            }
+        }
+        TUTORIAL_COUNT(track_candidates, result.track_candidates.size());
+    }
+
+    /// Track fitting
+    void fit_tracks(chain_result& result, stage_times& times) const {
+        {
+            scoped_stage_timer t{times, stage::track_fitting};
+            if (m_batched_fitting && m_cfg.use_filtered_smoothing) {
+                result.batched_track_states =
+                    m_batched_fitting->smooth_filtered(result.filtered_tracks);
+            } else if (m_batched_fitting) {
+                result.batched_track_states =
+                    (*m_batched_fitting)(result.track_candidates);
+            } else if (m_adaptive_fitting) {
+                result.track_states = (*m_adaptive_fitting)(
+                    m_det, m_field, result.track_candidates,
+                    &result.fit_iterations);
+            } else {
+                result.track_states = m_fitting(
+                    m_det, m_field, traccc::get_data(result.track_candidates));
+                TUTORIAL_COUNT(
+                    kf_updates,
+                    m_cfg.fitting.n_iterations *
+                        n_candidate_measurements(result.track_candidates));
+            }
+        }
+        TUTORIAL_COUNT(fitted_tracks, m_batched_fitting
+                                          ? result.batched_track_states.size()
+                                          : result.track_states.size());
+    }
+
+    /// @}
+
+    private:
+    /// Hash of everything that the products up to the track parameters
+    /// depend on, besides the cells
+    static std::uint64_t upstream_hash(
+        const chain_config& cfg, const detector_type& det,
+        const silicon_detector_description::host& dd) {
+
+        // Bump when the products change for the same input
+        constexpr std::uint32_t format_version = 1u;
+        product_hasher hasher;
+        hasher.add(format_version).add(sizeof(scalar));
+        hasher.add(cfg.B).add(cfg.use_parallel_clusterization);
+        if (cfg.use_parallel_clusterization) {
+            hasher.add(cfg.parallel_clusterization);
+        }
+        hasher.add(cfg.finder).add(cfg.grid).add(cfg.filter);
+        hasher.add(cfg.use_grid_seeding);
+        if (cfg.use_grid_seeding) {
+            hasher.add(cfg.grid_seeding);
+        }
+        for (const module_placement& module : sensitive_modules(det)) {
+            hasher.add(module.barcode).add(module.transform);
+        }
+        for (unsigned int i = 0; i < dd.size(); ++i) {
+            hasher.add(dd.geometry_id()[i])
+                .add(dd.reference_x()[i])
+                .add(dd.reference_y()[i])
+                .add(dd.pitch_x()[i])
+                .add(dd.pitch_y()[i])
+                .add(dd.dimensions()[i]);
+        }
+        return hasher.value();
+    }
+
+    /// Configuration of the chain
+    chain_config m_cfg;
+
+    /// @name Shared, read-only event-independent data
+    /// @{
+    const detector_type& m_det;
+    const silicon_detector_description::host& m_dd;
+    const field_type& m_field;
+    /// @}
+
+    /// Memory resource of the event data products
+    vecmem::memory_resource& m_mr;
+
+    /// @name Algorithms of the chain
+    /// @{
+    host::clusterization_algorithm m_clusterization;
+    std::optional<parallel_clusterization> m_parallel_clusterization;
+    host::silicon_pixel_spacepoint_formation_algorithm m_spacepoint_formation;
+    seeding_algorithm m_seeding;
+    std::optional<grid_seeding> m_grid_seeding;
+    track_params_estimation m_track_params_estimation;
+    host::combinatorial_kalman_filter_algorithm m_finding;
+    std::optional<parallel_track_finding> m_parallel_finding;
+    std::optional<telescope_track_finding> m_telescope_finding;
+    std::optional<greedy_ambiguity_resolution> m_ambiguity_resolution;
+    host::kalman_fitting_algorithm m_fitting;
+    std::optional<adaptive_kalman_fitting> m_adaptive_fitting;
+    std::optional<batched_fitter_type> m_batched_fitting;
+    /// @}
+
+    /// Cache of the products up to the track parameters, if any
+    std::optional<product_cache> m_product_cache;
+
+};  // class reconstruction_chain
+
+}  // namespace traccc::tutorial
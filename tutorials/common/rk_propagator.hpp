@@ -0,0 +1,205 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/instrumentation.hpp"
+#include "common/telescope_navigator.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace traccc::tutorial {
+
+/// Configuration of @c rk_propagator
+struct rk_propagator_config {
+    /// Longest Runge-Kutta step
+    double max_step = 50. * unit<double>::mm;
+    /// Distance from a plane at which it counts as reached
+    double tolerance = 1e-4 * unit<double>::mm;
+    /// Maximum number of steps between two planes
+    unsigned int max_steps = 1000u;
+};
+
+/// Runge-Kutta propagation through the telescope in any magnetic field
+///
+/// Tracks are transported with fourth order Runge-Kutta-Nystrom steps, as in
+/// traccc's @c rk_stepper, and every plane of the telescope (in the order
+/// given by a @c telescope_navigator) is approached with straight-line
+/// estimates of the remaining path. As with the navigator, only crossings
+/// within the bounds of the modules are reported.
+///
+/// The field is any type with a @c cache_type and a
+/// @c vector3 at(const point3&, cache_type&) const lookup, such as
+/// @c field_map or @c uniform_field. Every propagated track has its own
+/// cache, so the three field lookups of a step (the two middle stages share
+/// one) usually hit the cell found by the previous lookup.
+///
+template <typename field_t>
+class rk_propagator {
+
+    public:
+    /// Construct the propagator
+    ///
+    /// @param navigator Provides the planes, in position order
+    /// @param field     The magnetic field
+    /// @param cfg       The propagator configuration
+    ///
+    rk_propagator(const telescope_navigator& navigator, const field_t& field,
+                  const rk_propagator_config& cfg = {})
+        : m_navigator(navigator), m_field(field), m_cfg(cfg) {}
+
+    /// Propagate a track through all planes ahead of it
+    ///
+    /// Has the interface of @c telescope_navigator::propagate.
+    ///
+    template <typename callback_t>
+    void propagate(const point3& pos, const vector3& dir, scalar qop,
+                   callback_t&& on_crossing) const {
+
+        track_state st;
+        for (std::size_t a = 0; a < 3u; ++a) {
+            st.pos[a] = static_cast<double>(pos[a]);
+            st.dir[a] = static_cast<double>(dir[a]);
+        }
+        st.qop = static_cast<double>(qop);
+        typename field_t::cache_type cache;
+
+        const double forward = (st.dir[0] > 0.) ? 1. : -1.;
+        const std::size_t n = m_navigator.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t plane = (forward > 0.) ? i : n - 1u - i;
+            const double target = m_navigator.plane_position(plane);
+            if ((target - st.pos[0]) * forward <= 0.) {
+                continue;
+            }
+            if (!step_to(st, target, forward, cache)) {
+                return;
+            }
+            plane_crossing crossing;
+            crossing.module = m_navigator.plane_module(plane);
+            crossing.position = {static_cast<scalar>(target),
+                                 static_cast<scalar>(st.pos[1]),
+                                 static_cast<scalar>(st.pos[2])};
+            crossing.direction = {static_cast<scalar>(st.dir[0]),
+                                  static_cast<scalar>(st.dir[1]),
+                                  static_cast<scalar>(st.dir[2])};
+            crossing.path = static_cast<scalar>(st.path);
+            if (!m_navigator.on_module(plane, crossing.position)) {
+                continue;
+            }
+            if (!on_crossing(crossing)) {
+                return;
+            }
+        }
+    }
+
+    private:
+    /// State of a propagated track
+    struct track_state {
+        std::array<double, 3> pos;
+        std::array<double, 3> dir;
+        double qop;
+        double path = 0.;
+    };
+
+    /// Step until the plane at x = @c target
+    ///
+    /// @return @c false if the track turns back before the plane
+    ///
+    template <typename cache_t>
+    bool step_to(track_state& st, double target, double forward,
+                 cache_t& cache) const {
+
+        for (unsigned int i = 0; i < m_cfg.max_steps; ++i) {
+            const double remaining = target - st.pos[0];
+            if (std::abs(remaining) < m_cfg.tolerance) {
+                return true;
+            }
+            if (st.dir[0] * forward <= 0.) {
+                return false;
+            }
+            const double h = std::clamp(remaining / st.dir[0], -m_cfg.max_step,
+                                        m_cfg.max_step);
+            step(st, h, cache);
+        }
+        return false;
+    }
+
+    /// One Runge-Kutta-Nystrom step of length @c h
+    template <typename cache_t>
+    void step(track_state& st, double h, cache_t& cache) const {
+
+        TUTORIAL_COUNT(rk_propagator_steps, 1);
+        const auto field = [&](const std::array<double, 3>& p) {
+            const vector3 B = m_field.at(
+                point3{static_cast<scalar>(p[0]), static_cast<scalar>(p[1]),
+                       static_cast<scalar>(p[2])},
+                cache);
+            return std::array<double, 3>{static_cast<double>(B[0]),
+                                         static_cast<double>(B[1]),
+                                         static_cast<double>(B[2])};
+        };
+        // dT/ds = qop * (T x B)
+        const auto derivative = [&](const std::array<double, 3>& t,
+                                    const std::array<double, 3>& B) {
+            return std::array<double, 3>{st.qop * (t[1] * B[2] - t[2] * B[1]),
+                                         st.qop * (t[2] * B[0] - t[0] * B[2]),
+                                         st.qop * (t[0] * B[1] - t[1] * B[0])};
+        };
+        const auto combine = [](const std::array<double, 3>& a, double f,
+                                const std::array<double, 3>& b) {
+            return std::array<double, 3>{a[0] + f * b[0], a[1] + f * b[1],
+                                         a[2] + f * b[2]};
+        };
+
+        const std::array<double, 3>& T = st.dir;
+        const std::array<double, 3> k1 = derivative(T, field(st.pos));
+
+        const std::array<double, 3> mid =
+            combine(combine(st.pos, 0.5 * h, T), 0.125 * h * h, k1);
+        const std::array<double, 3> B_mid = field(mid);
+        const std::array<double, 3> k2 =
+            derivative(combine(T, 0.5 * h, k1), B_mid);
+        const std::array<double, 3> k3 =
+            derivative(combine(T, 0.5 * h, k2), B_mid);
+
+        const std::array<double, 3> end =
+            combine(combine(st.pos, h, T), 0.5 * h * h, k3);
+        const std::array<double, 3> k4 = derivative(combine(T, h, k3), field(end));
+
+        std::array<double, 3> dir;
+        double norm2 = 0.;
+        for (std::size_t a = 0; a < 3u; ++a) {
+            st.pos[a] += h * T[a] + h * h / 6. * (k1[a] + k2[a] + k3[a]);
+            dir[a] = T[a] + h / 6. * (k1[a] + 2. * k2[a] + 2. * k3[a] + k4[a]);
+            norm2 += dir[a] * dir[a];
+        }
+        const double inv_norm = 1. / std::sqrt(norm2);
+        for (std::size_t a = 0; a < 3u; ++a) {
+            st.dir[a] = dir[a] * inv_norm;
+        }
+        st.path += h;
+    }
+
+    /// The planes of the telescope
+    const telescope_navigator& m_navigator;
+    /// The magnetic field
+    const field_t& m_field;
+    /// Configuration of the propagator
+    rk_propagator_config m_cfg;
+
+};  // class rk_propagator
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,115 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cmath>
+#include <cstddef>
+
+namespace traccc::tutorial {
+
+/// A fixed number of values of the same quantity, one per SIMD lane
+///
+/// All operations act lane by lane through fixed-length loops, which the
+/// compiler turns into vector instructions. Structures of these (e.g. a
+/// 5x5 matrix of @c lanes) give an AoSoA layout: one matrix element of
+/// @c LANES tracks is contiguous in memory.
+///
+template <typename T, std::size_t LANES>
+struct alignas(sizeof(T) * LANES) lanes {
+
+    using value_type = T;
+    static constexpr std::size_t size = LANES;
+
+    /// The values
+    T v[LANES];
+
+    /// The same value in every lane
+    static lanes broadcast(T value) {
+        lanes result;
+        for (std::size_t i = 0; i < LANES; ++i) {
+            result.v[i] = value;
+        }
+        return result;
+    }
+
+    /// @name Lane access
+    /// @{
+    T& operator[](std::size_t i) { return v[i]; }
+    const T& operator[](std::size_t i) const { return v[i]; }
+    /// @}
+
+    /// @name Lane-wise arithmetic
+    /// @{
+    lanes& operator+=(const lanes& o) {
+        for (std::size_t i = 0; i < LANES; ++i) {
+            v[i] += o.v[i];
+        }
+        return *this;
+    }
+    lanes& operator-=(const lanes& o) {
+        for (std::size_t i = 0; i < LANES; ++i) {
+            v[i] -= o.v[i];
+        }
+        return *this;
+    }
+    lanes& operator*=(const lanes& o) {
+        for (std::size_t i = 0; i < LANES; ++i) {
+            v[i] *= o.v[i];
+        }
+        return *this;
+    }
+    lanes& operator/=(const lanes& o) {
+        for (std::size_t i = 0; i < LANES; ++i) {
+            v[i] /= o.v[i];
+        }
+        return *this;
+    }
+    friend lanes operator+(lanes a, const lanes& b) { return a += b; }
+    friend lanes operator-(lanes a, const lanes& b) { return a -= b; }
+    friend lanes operator*(lanes a, const lanes& b) { return a *= b; }
+    friend lanes operator/(lanes a, const lanes& b) { return a /= b; }
+    friend lanes operator*(T a, lanes b) { return broadcast(a) *= b; }
+    friend lanes operator-(lanes a) {
+        for (std::size_t i = 0; i < LANES; ++i) {
+            a.v[i] = -a.v[i];
+        }
+        return a;
+    }
+    /// @}
+
+};  // struct lanes
+
+/// Lane-wise square root
+template <typename T, std::size_t LANES>
+lanes<T, LANES> sqrt(lanes<T, LANES> a) {
+    for (std::size_t i = 0; i < LANES; ++i) {
+        a.v[i] = std::sqrt(a.v[i]);
+    }
+    return a;
+}
+
+/// Lane-wise natural logarithm
+template <typename T, std::size_t LANES>
+lanes<T, LANES> log(lanes<T, LANES> a) {
+    for (std::size_t i = 0; i < LANES; ++i) {
+        a.v[i] = std::log(a.v[i]);
+    }
+    return a;
+}
+
+/// Lane-wise absolute value
+template <typename T, std::size_t LANES>
+lanes<T, LANES> abs(lanes<T, LANES> a) {
+    for (std::size_t i = 0; i < LANES; ++i) {
+        a.v[i] = std::abs(a.v[i]);
+    }
+    return a;
+}
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,235 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/instrumentation.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Stages of the reconstruction chain, in the order in which they run
+enum class stage : std::size_t {
+    clusterization = 0,
+    spacepoint_formation,
+    seeding,
+    track_params_estimation,
+    track_finding,
+    track_fitting,
+    n_stages
+};
+
+/// Number of stages in the reconstruction chain
+inline constexpr std::size_t n_stages =
+    static_cast<std::size_t>(stage::n_stages);
+
+/// Printable name of a reconstruction stage
+inline constexpr std::string_view stage_name(stage s) {
+    constexpr std::array<std::string_view, n_stages> names{
+        "clusterization",  "spacepoint_formation", "seeding",
+        "track_params_est", "track_finding",        "track_fitting"};
+    return names[static_cast<std::size_t>(s)];
+}
+
+/// Instrumentation timer of a reconstruction stage
+///
+/// The stages are the first timers of the instrumentation, in the same
+/// order, which the assertions below keep that way.
+///
+inline constexpr instrumentation::timer instrumentation_timer(stage s) {
+    return static_cast<instrumentation::timer>(s);
+}
+static_assert(instrumentation_timer(stage::clusterization) ==
+              instrumentation::timer::clusterization);
+static_assert(instrumentation_timer(stage::spacepoint_formation) ==
+              instrumentation::timer::spacepoint_formation);
+static_assert(instrumentation_timer(stage::seeding) ==
+              instrumentation::timer::seeding);
+static_assert(instrumentation_timer(stage::track_params_estimation) ==
+              instrumentation::timer::track_params_estimation);
+static_assert(instrumentation_timer(stage::track_finding) ==
+              instrumentation::timer::track_finding);
+static_assert(instrumentation_timer(stage::track_fitting) ==
+              instrumentation::timer::track_fitting);
+static_assert(n_stages <= instrumentation::n_timers);
+
+/// Stage that the calling thread is running, @c stage::n_stages outside
+/// of all stages
+///
+/// Set by @c scoped_stage_timer, so that e.g. a memory resource can
+/// attribute its allocations to the stage that makes them.
+///
+inline stage& current_stage() {
+    thread_local stage s = stage::n_stages;
+    return s;
+}
+
+/// Makes a stage the @c current_stage() of the thread for its lifetime
+///
+/// @c thread_pool uses it to run helper tasks in the stage of the thread
+/// that submitted them.
+///
+class scoped_current_stage {
+
+    public:
+    explicit scoped_current_stage(stage s)
+        : m_outer_stage(std::exchange(current_stage(), s)) {}
+    ~scoped_current_stage() { current_stage() = m_outer_stage; }
+
+    scoped_current_stage(const scoped_current_stage&) = delete;
+    scoped_current_stage& operator=(const scoped_current_stage&) = delete;
+
+    private:
+    /// Stage of the thread before this one started
+    stage m_outer_stage;
+
+};  // class scoped_current_stage
+
+/// Wall time spent in every stage of the chain
+struct stage_times {
+
+    using clock = std::chrono::steady_clock;
+    using duration = std::chrono::duration<double>;
+
+    /// Accumulated wall time per stage
+    std::array<duration, n_stages> times{};
+
+    /// Access the time of one stage
+    duration& operator[](stage s) {
+        return times[static_cast<std::size_t>(s)];
+    }
+    /// Access the time of one stage (const)
+    const duration& operator[](stage s) const {
+        return times[static_cast<std::size_t>(s)];
+    }
+
+    /// Sum of all stage times
+    duration total() const {
+        duration result{};
+        for (const auto& t : times) {
+            result += t;
+        }
+        return result;
+    }
+
+    /// Accumulate the times of another (e.g. per-event) measurement
+    stage_times& operator+=(const stage_times& other) {
+        for (std::size_t i = 0; i < n_stages; ++i) {
+            times[i] += other.times[i];
+        }
+        return *this;
+    }
+
+};  // struct stage_times
+
+/// Adds the lifetime of the object to the time of one stage
+///
+/// The stage is also the @c current_stage() of the thread for that time.
+///
+class scoped_stage_timer {
+
+    public:
+    scoped_stage_timer(stage_times& times, stage s)
+        : m_time(times[s]),
+          m_stage(s),
+          m_current_stage(s),
+          m_start(stage_times::clock::now()) {}
+    ~scoped_stage_timer() {
+        const stage_times::duration elapsed =
+            stage_times::clock::now() - m_start;
+        m_time += elapsed;
+        if constexpr (instrumentation::enabled) {
+            instrumentation::add(instrumentation_timer(m_stage), elapsed);
+        }
+    }
+
+    scoped_stage_timer(const scoped_stage_timer&) = delete;
+    scoped_stage_timer& operator=(const scoped_stage_timer&) = delete;
+
+    private:
+    stage_times::duration& m_time;
+    stage m_stage;
+    /// Makes @c m_stage the stage of the thread
+    scoped_current_stage m_current_stage;
+    stage_times::clock::time_point m_start;
+
+};  // class scoped_stage_timer
+
+/// Print the throughput and the per-stage breakdown of a run
+///
+/// @param out       The stream to print to
+/// @param times     Stage times accumulated over all events
+/// @param n_events  Number of processed events
+/// @param wall_time Wall time of the whole event loop
+///
+inline void print_stage_report(std::ostream& out, const stage_times& times,
+                               std::size_t n_events,
+                               stage_times::duration wall_time) {
+
+    const double total = times.total().count();
+    out << std::endl;
+    out << "Processed " << n_events << " events in " << wall_time.count()
+        << " s (" << static_cast<double>(n_events) / wall_time.count()
+        << " events/s)" << std::endl;
+    out << std::endl;
+    out << std::left << std::setw(22) << "stage" << std::right
+        << std::setw(12) << "total [ms]" << std::setw(14) << "per event [ms]"
+        << std::setw(10) << "share" << std::endl;
+    for (std::size_t i = 0; i < n_stages; ++i) {
+        const double t = times.times[i].count();
+        out << std::left << std::setw(22) << stage_name(static_cast<stage>(i))
+            << std::right << std::fixed << std::setprecision(3)
+            << std::setw(12) << t * 1e3 << std::setw(14)
+            << (n_events > 0 ? t * 1e3 / static_cast<double>(n_events) : 0.)
+            << std::setw(9) << std::setprecision(1)
+            << (total > 0. ? 100. * t / total : 0.) << "%" << std::endl;
+    }
+    out << std::defaultfloat << std::setprecision(6) << std::endl;
+}
+
+/// Print the distribution of the latencies of individual requests
+///
+/// @param out       The stream to print to
+/// @param what      What the latencies are of, e.g. "request"
+/// @param latencies The latency of every request
+///
+inline void print_latency_report(std::ostream& out, std::string_view what,
+                                 std::vector<stage_times::duration> latencies) {
+
+    if (latencies.empty()) {
+        return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    stage_times::duration sum{};
+    for (const auto& latency : latencies) {
+        sum += latency;
+    }
+    const auto quantile = [&latencies](double q) {
+        const auto i = static_cast<std::size_t>(
+            q * static_cast<double>(latencies.size() - 1u) + 0.5);
+        return latencies[i].count() * 1e3;
+    };
+    out << "Latency per " << what << " [ms] over " << latencies.size()
+        << ": mean " << std::fixed << std::setprecision(3)
+        << sum.count() * 1e3 / static_cast<double>(latencies.size())
+        << ", median " << quantile(0.5) << ", p90 " << quantile(0.9)
+        << ", p99 " << quantile(0.99) << ", max " << quantile(1.)
+        << std::defaultfloat << std::setprecision(6) << std::endl;
+}
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,253 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/detector_utils.hpp"
+#include "common/instrumentation.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Crossing of a track with one plane of the telescope
+struct plane_crossing {
+    /// Index of the module in the navigator's module list
+    unsigned int module;
+    /// Global position of the crossing
+    point3 position;
+    /// Direction of the track at the crossing
+    vector3 direction;
+    /// Path length from the start of the propagation
+    scalar path;
+};
+
+/// Navigation and propagation through an ordered telescope of planes
+///
+/// The generic detray navigator builds and sorts a list of candidate
+/// surfaces for every step. For the tutorial's telescope, whose modules are
+/// planes perpendicular to the x-axis in a field along z, none of this is
+/// needed: the planes are sorted by their position once, the next plane of a
+/// track is the next entry of that list, and the crossing of the helix with
+/// it is found in closed form. A track therefore costs one square root and
+/// one arctangent per crossed plane.
+///
+/// Like @c detray::navigator, the navigator only reports crossings within
+/// the bounds of the modules. It does not apply any material effects: the
+/// track is propagated on its helix, as detray's propagator does without a
+/// material interactor.
+///
+class telescope_navigator {
+
+    public:
+    /// Construct the navigator
+    ///
+    /// @param modules The sensitive modules, one per plane, perpendicular to
+    ///                the x-axis
+    /// @param B       The (constant) magnetic field, along z
+    /// @param counted Whether the tested planes are added to the
+    ///                @c telescope_navigator_tests counter
+    ///
+    telescope_navigator(const std::vector<module_placement>& modules,
+                        const vector3& B, bool counted = true)
+        : m_bz(static_cast<double>(B[2])), m_counted(counted) {
+
+        if (B[0] != 0.f || B[1] != 0.f) {
+            throw std::invalid_argument(
+                "The telescope navigator needs a magnetic field along z");
+        }
+        std::vector<unsigned int> order(modules.size());
+        std::iota(order.begin(), order.end(), 0u);
+        for (const auto& module : modules) {
+            if (std::abs(std::abs(module.transform.z()[0]) - 1.f) > 1e-6f) {
+                throw std::invalid_argument(
+                    "The telescope navigator needs planes perpendicular to x");
+            }
+        }
+        const auto position = [&](unsigned int m) {
+            return static_cast<double>(modules[m].transform.translation()[0]);
+        };
+        std::sort(order.begin(), order.end(),
+                  [&](unsigned int a, unsigned int b) {
+                      return position(a) < position(b);
+                  });
+        for (const unsigned int m : order) {
+            if (!m_positions.empty() && position(m) == m_positions.back()) {
+                throw std::invalid_argument(
+                    "The telescope navigator needs one module per plane");
+            }
+            m_positions.push_back(position(m));
+            m_modules.push_back(m);
+            m_transforms.push_back(modules[m].transform);
+            m_half_lengths.push_back(modules[m].half_lengths);
+        }
+    }
+
+    /// Number of planes
+    std::size_t size() const { return m_positions.size(); }
+    /// Position along x of plane @c plane (in position order)
+    double plane_position(std::size_t plane) const {
+        return m_positions[plane];
+    }
+    /// Module index of plane @c plane (in position order)
+    unsigned int plane_module(std::size_t plane) const {
+        return m_modules[plane];
+    }
+    /// Whether a global position on plane @c plane is within its module
+    bool on_module(std::size_t plane, const point3& position) const {
+        const point3 local = m_transforms[plane].point_to_local(position);
+        return (std::abs(local[0]) <= m_half_lengths[plane][0] &&
+                std::abs(local[1]) <= m_half_lengths[plane][1]);
+    }
+
+    /// Propagate a track through all planes ahead of it
+    ///
+    /// Planes that the track crosses outside of the module are skipped.
+    ///
+    /// @param pos         Starting position
+    /// @param dir         Starting direction (unit vector)
+    /// @param qop         q/p of the track
+    /// @param on_crossing Called with a @c plane_crossing for every crossed
+    ///                    plane, in the order of crossing; returning @c false
+    ///                    stops the propagation
+    ///
+    template <typename callback_t>
+    void propagate(const point3& pos, const vector3& dir, scalar qop,
+                   callback_t&& on_crossing) const {
+
+        const helix_start start(pos, dir, qop, m_bz);
+        if (start.cos_psi == 0.) {
+            return;
+        }
+        if (start.cos_psi > 0.) {
+            const auto first = std::upper_bound(
+                m_positions.begin(), m_positions.end(), start.x);
+            for (auto it = first; it != m_positions.end(); ++it) {
+                if (!cross(start, static_cast<std::size_t>(
+                                      it - m_positions.begin()),
+                           on_crossing)) {
+                    return;
+                }
+            }
+        } else {
+            const auto first = std::lower_bound(
+                m_positions.begin(), m_positions.end(), start.x);
+            for (auto it = first; it != m_positions.begin();) {
+                --it;
+                if (!cross(start, static_cast<std::size_t>(
+                                      it - m_positions.begin()),
+                           on_crossing)) {
+                    return;
+                }
+            }
+        }
+    }
+
+    private:
+    /// Starting point of a helix, with the field along z
+    ///
+    /// The transverse direction is at angle psi, and psi changes as
+    /// psi(s) = psi0 + w s with w = -qop * Bz.
+    ///
+    struct helix_start {
+        helix_start(const point3& pos, const vector3& dir, scalar qop,
+                    double bz)
+            : x(pos[0]),
+              y(pos[1]),
+              z(pos[2]),
+              sin_theta(std::hypot(static_cast<double>(dir[0]),
+                                   static_cast<double>(dir[1]))),
+              cos_theta(dir[2]),
+              cos_psi(sin_theta > 0. ? dir[0] / sin_theta : 0.),
+              sin_psi(sin_theta > 0. ? dir[1] / sin_theta : 0.),
+              w(-static_cast<double>(qop) * bz) {}
+        double x, y, z;
+        double sin_theta, cos_theta, cos_psi, sin_psi;
+        double w;
+    };
+
+    /// Cross plane number @c plane (in position order)
+    ///
+    /// @return @c false if the helix turns back before the plane, or if
+    ///         @c on_crossing stopped the propagation
+    ///
+    template <typename callback_t>
+    bool cross(const helix_start& st, std::size_t plane,
+               callback_t&& on_crossing) const {
+
+        if (m_counted) {
+            TUTORIAL_COUNT(telescope_navigator_tests, 1);
+        }
+        // x(s) = x0 + sin(theta) / w * (sin(psi(s)) - sin(psi0)), so at the
+        // plane sin(psi1) = sin(psi0) + delta.
+        const double dx = m_positions[plane] - st.x;
+        const double delta = st.w * dx / st.sin_theta;
+        const double sin_psi1 = st.sin_psi + delta;
+        if (std::abs(sin_psi1) >= 1.) {
+            return false;
+        }
+        const double cos_psi1 =
+            std::copysign(std::sqrt(1. - sin_psi1 * sin_psi1), st.cos_psi);
+
+        // Both expressions are proportional to delta, so they stay precise
+        // for straight tracks.
+        const double cos_sum = cos_psi1 + st.cos_psi;
+        const double dy = dx * (2. * st.sin_psi + delta) / cos_sum;
+        const double d_cos = -delta * (2. * st.sin_psi + delta) / cos_sum;
+        const double transverse_path =
+            (std::abs(delta) < 1e-12)
+                ? dx / st.cos_psi
+                : std::atan2(delta * st.cos_psi - d_cos * st.sin_psi,
+                             cos_psi1 * st.cos_psi + sin_psi1 * st.sin_psi) /
+                      st.w * st.sin_theta;
+        const double s = transverse_path / st.sin_theta;
+        if (!(s > 0.)) {
+            return false;
+        }
+
+        plane_crossing crossing;
+        crossing.module = m_modules[plane];
+        crossing.position = {static_cast<scalar>(m_positions[plane]),
+                             static_cast<scalar>(st.y + dy),
+                             static_cast<scalar>(st.z + st.cos_theta * s)};
+        if (!on_module(plane, crossing.position)) {
+            return true;
+        }
+        crossing.direction = {static_cast<scalar>(cos_psi1 * st.sin_theta),
+                              static_cast<scalar>(sin_psi1 * st.sin_theta),
+                              static_cast<scalar>(st.cos_theta)};
+        crossing.path = static_cast<scalar>(s);
+        return on_crossing(crossing);
+    }
+
+    /// Field along z
+    double m_bz;
+    /// Whether the tested planes are counted
+    bool m_counted;
+    /// Positions of the planes along x, in increasing order
+    std::vector<double> m_positions;
+    /// Module index of every plane
+    std::vector<unsigned int> m_modules;
+    /// Transform of the module of every plane
+    std::vector<default_detector::host::transform3_type> m_transforms;
+    /// Half-lengths of the module of every plane
+    std::vector<std::array<scalar, 2>> m_half_lengths;
+
+};  // class telescope_navigator
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,327 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/batched_kalman_fitter.hpp"
+#include "common/detector_utils.hpp"
+#include "common/instrumentation.hpp"
+#include "common/measurement_index.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_candidate.hpp"
+#include "traccc/edm/track_parameters.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Configuration of @c telescope_track_finding
+struct telescope_finding_config {
+    /// Largest chi2 (with two degrees of freedom) of a measurement added to
+    /// a branch
+    double max_chi2 = 30.;
+    /// Largest number of branches grown from one branch on one plane
+    unsigned int max_branches_per_plane = 3u;
+    /// Largest number of branches of one seed kept after every plane
+    unsigned int max_branches_per_seed = 10u;
+    /// Largest number of consecutive planes without a measurement
+    unsigned int max_holes = 1u;
+    /// Fewest measurements of a track candidate
+    unsigned int min_measurements = 3u;
+};
+
+/// Combinatorial Kalman filter for the telescope
+///
+/// Every seed is followed through the planes after its own one. On each
+/// plane, every branch is extended by each of its compatible measurements
+/// (up to @c max_branches_per_plane, best chi2 first), or by a hole if
+/// there is none. The branches of a seed are pruned to the
+/// @c max_branches_per_seed with the most measurements and the smallest
+/// chi2, and those with enough measurements become track candidates, with
+/// the seed as their header, as with traccc's CKF.
+///
+/// The branches are filtered with the steps of @c batched_kalman_fitter,
+/// in exactly the way its forward filter treats the measurements of a
+/// candidate. The forward filter states of the candidates can therefore be
+/// handed to @c batched_kalman_fitter::smooth_filtered, which then only has
+/// to run the smoother. The measurements of a plane are looked up in a
+/// @c measurement_index.
+///
+class telescope_track_finding {
+
+    public:
+    /// The filter steps
+    using kernel_type = batched_kalman_fitter<1u, double>;
+    /// Forward filter states of a candidate
+    using filtered_track_type = kernel_type::filtered_track_type;
+
+    /// Construct the algorithm
+    ///
+    /// @param cfg     The track finding configuration
+    /// @param fit_cfg Configuration of the filter steps; to hand the states
+    ///                over, this has to be the fitter's configuration
+    /// @param modules The sensitive modules
+    /// @param B       The (constant) magnetic field
+    /// @param mr      Memory resource for the output candidates
+    ///
+    telescope_track_finding(const telescope_finding_config& cfg,
+                            const batched_fitter_config& fit_cfg,
+                            const std::vector<module_placement>& modules,
+                            const vector3& B, vecmem::memory_resource& mr)
+        : m_cfg(cfg), m_kernel(fit_cfg, modules, B), m_mr(mr) {
+
+        for (const auto& module : modules) {
+            m_planes.push_back(
+                {static_cast<double>(module.transform.translation()[0]),
+                 module.barcode});
+        }
+        std::stable_sort(m_planes.begin(), m_planes.end(),
+                         [](const plane& a, const plane& b) {
+                             return a.x < b.x;
+                         });
+        for (std::size_t i = 0; i < m_planes.size(); ++i) {
+            m_plane_index.emplace(m_planes[i].barcode.value(), i);
+        }
+    }
+
+    /// Find the track candidates of an event
+    ///
+    /// @param measurements The measurements, sorted by @c index
+    /// @param index        Per-surface ranges of @c measurements
+    /// @param seeds        Track parameters of the seeds
+    /// @param filtered     If not null, receives the forward filter states of
+    ///                     every candidate, in the order of the candidates
+    /// @return The track candidates
+    ///
+    track_candidate_container_types::host operator()(
+        const measurement_collection_types::host& measurements,
+        const measurement_index& index,
+        const bound_track_parameters_collection_types::host& seeds,
+        std::vector<filtered_track_type>* filtered = nullptr) const {
+
+        std::vector<branch> found;
+        std::vector<std::size_t> found_seeds;
+        for (std::size_t s = 0; s < seeds.size(); ++s) {
+            const std::size_t n_found = found.size();
+            find(measurements, index, seeds[s], found);
+            found_seeds.insert(found_seeds.end(), found.size() - n_found, s);
+        }
+
+        track_candidate_container_types::host result{&m_mr};
+        result.resize(found.size());
+        if (filtered != nullptr) {
+            filtered->clear();
+            filtered->reserve(found.size());
+        }
+        for (std::size_t i = 0; i < found.size(); ++i) {
+            result.at(i).header = seeds[found_seeds[i]];
+            for (const unsigned int m : found[i].measurements) {
+                result.at(i).items.push_back(measurements[m]);
+            }
+            if (filtered != nullptr) {
+                filtered->push_back(std::move(found[i].track));
+            }
+        }
+        return result;
+    }
+
+    private:
+    /// A plane of the telescope
+    struct plane {
+        double x;
+        detray::geometry::barcode barcode;
+    };
+
+    /// A branch of the combinatorial search
+    struct branch {
+        /// Last filtered state, or the seed before the first measurement
+        kernel_type::state_type state;
+        /// Global x of @c state
+        double x = 0.;
+        /// Indices of the measurements
+        std::vector<unsigned int> measurements;
+        /// Forward filter states of the measurements, and their chi2
+        filtered_track_type track;
+        /// Consecutive planes without a measurement
+        unsigned int holes = 0u;
+    };
+
+    /// Grow the branches of one seed, and add its candidates to @c found
+    void find(const measurement_collection_types::host& measurements,
+              const measurement_index& index,
+              const bound_track_parameters& seed,
+              std::vector<branch>& found) const {
+
+        const auto seed_plane = m_plane_index.find(seed.surface_link().value());
+        if (seed_plane == m_plane_index.end()) {
+            return;
+        }
+
+        // Position of the seed on its plane, with the seed's uncertainty
+        measurement seed_position;
+        seed_position.local = seed.bound_local();
+        seed_position.surface_link = seed.surface_link();
+        const kernel_type::plane_measurement seed_point =
+            m_kernel.convert(seed_position);
+        std::vector<branch> branches(1u);
+        branches.front().state = m_kernel.start_state(seed_point, seed);
+        branches.front().x = seed_point.x;
+
+        std::vector<branch> next;
+        std::vector<std::pair<double, unsigned int>> compatible;
+        for (std::size_t p = seed_plane->second; p < m_planes.size(); ++p) {
+            const plane& pl = m_planes[p];
+            const measurement_range range = index[pl.barcode];
+            next.clear();
+            for (branch& b : branches) {
+                kernel_type::state_type predicted = b.state;
+                kernel_type::jacobian_type J{};
+                const double dx = pl.x - b.x;
+                if (dx != 0.) {
+                    m_kernel.predict_state(
+                        b.state, kernel_type::value_type::broadcast(dx), J,
+                        predicted);
+                }
+
+                compatible.clear();
+                for (unsigned int m = range.begin; m < range.end; ++m) {
+                    const double chi2 =
+                        kernel_type::residual_chi2(
+                            predicted, m_kernel.convert(measurements[m]))[0];
+                    if (chi2 < m_cfg.max_chi2) {
+                        compatible.emplace_back(chi2, m);
+                    }
+                }
+                std::sort(compatible.begin(), compatible.end());
+                if (compatible.size() > m_cfg.max_branches_per_plane) {
+                    TUTORIAL_COUNT(telescope_ckf_branches_pruned,
+                                   compatible.size() -
+                                       m_cfg.max_branches_per_plane);
+                    compatible.resize(m_cfg.max_branches_per_plane);
+                }
+
+                if (compatible.empty()) {
+                    // A hole: keep transporting from the last state.
+                    if (++b.holes <= m_cfg.max_holes) {
+                        next.push_back(std::move(b));
+                    } else if (b.measurements.size() >=
+                               m_cfg.min_measurements) {
+                        found.push_back(std::move(b));
+                    }
+                    continue;
+                }
+                for (const auto& [chi2, m] : compatible) {
+                    TUTORIAL_COUNT(telescope_ckf_branches_created, 1);
+                    const kernel_type::plane_measurement meas =
+                        m_kernel.convert(measurements[m]);
+                    branch extended = b;
+                    filtered_track_type::plane_state st;
+                    st.x = pl.x;
+                    kernel_type::state_type state;
+                    if (b.measurements.empty()) {
+                        // Start like the fitter, on the first measurement.
+                        state = m_kernel.start_state(meas, seed);
+                        kernel_type::jacobian_type identity{};
+                        for (std::size_t i = 0; i < 5u; ++i) {
+                            identity.m[i][i] =
+                                kernel_type::value_type::broadcast(1.);
+                        }
+                        J = identity;
+                    } else {
+                        state = predicted;
+                    }
+                    store(state, st.predicted, st.predicted_covariance);
+                    store_matrix(J, st.jacobian);
+                    kernel_type::value_type chi2_sum =
+                        kernel_type::value_type::broadcast(0.);
+                    kernel_type::update_state(state, meas, chi2_sum);
+                    store(state, st.filtered, st.filtered_covariance);
+
+                    extended.state = state;
+                    extended.x = pl.x;
+                    extended.holes = 0u;
+                    extended.measurements.push_back(m);
+                    extended.track.states.push_back(st);
+                    extended.track.chi2 += chi2_sum[0];
+                    next.push_back(std::move(extended));
+                }
+            }
+
+            // Keep the branches with the most measurements and the best chi2.
+            if (next.size() > m_cfg.max_branches_per_seed) {
+                std::stable_sort(next.begin(), next.end(),
+                                 [](const branch& a, const branch& b) {
+                                     if (a.measurements.size() !=
+                                         b.measurements.size()) {
+                                         return a.measurements.size() >
+                                                b.measurements.size();
+                                     }
+                                     return a.track.chi2 < b.track.chi2;
+                                 });
+                TUTORIAL_COUNT(telescope_ckf_branches_pruned,
+                               next.size() - m_cfg.max_branches_per_seed);
+                next.resize(m_cfg.max_branches_per_seed);
+            }
+            branches.swap(next);
+        }
+
+        for (branch& b : branches) {
+            if (b.measurements.size() >= m_cfg.min_measurements) {
+                found.push_back(std::move(b));
+            }
+        }
+    }
+
+    /// Copy the parameters and covariance of a (one lane) state
+    static void store(const kernel_type::state_type& state,
+                      std::array<double, 5>& params,
+                      std::array<double, 25>& covariance) {
+        for (std::size_t i = 0; i < 5u; ++i) {
+            params[i] = state.x[i][0];
+            for (std::size_t k = 0; k < 5u; ++k) {
+                covariance[i * 5u + k] = state.C[i][k][0];
+            }
+        }
+    }
+
+    /// Copy a (one lane) Jacobian
+    static void store_matrix(const kernel_type::jacobian_type& J,
+                             std::array<double, 25>& out) {
+        for (std::size_t i = 0; i < 5u; ++i) {
+            for (std::size_t k = 0; k < 5u; ++k) {
+                out[i * 5u + k] = J.m[i][k][0];
+            }
+        }
+    }
+
+    /// The track finding configuration
+    telescope_finding_config m_cfg;
+    /// The filter steps, shared with the fitter
+    kernel_type m_kernel;
+    /// Memory resource for the output candidates
+    vecmem::memory_resource& m_mr;
+    /// The planes, in order of x
+    std::vector<plane> m_planes;
+    /// Index in @c m_planes of every module barcode
+    std::unordered_map<std::uint64_t, std::size_t> m_plane_index;
+
+};  // class telescope_track_finding
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,321 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/stage_timer.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Work-stealing thread pool
+///
+/// Every worker owns a task deque. Tasks submitted from a worker go to the
+/// front of its own deque and are picked up from there (LIFO, cache-warm),
+/// tasks submitted from outside are spread round-robin over the workers.
+/// Idle workers steal from the back of the other deques (FIFO), so long
+/// tasks do not leave the rest of the pool idle.
+///
+/// Tasks receive the index of the worker executing them, which is what
+/// per-worker state (algorithm instances, memory resources) is keyed on.
+/// They run in the @c current_stage() of the thread that submitted them, so
+/// e.g. the allocations of the helpers of a parallel stage are counted for
+/// that stage.
+///
+/// An exception thrown by a task does not stop the worker. The first one is
+/// kept and rethrown by the next @c wait(); @c parallel_for rethrows the
+/// first exception of its own work.
+///
+class thread_pool {
+
+    public:
+    /// Task type, called with the index of the executing worker
+    using task_type = std::function<void(std::size_t)>;
+
+    /// Start @c n_threads workers (at least one)
+    explicit thread_pool(std::size_t n_threads)
+        : m_queues(std::max<std::size_t>(n_threads, 1u)) {
+        for (auto& q : m_queues) {
+            q = std::make_unique<worker_queue>();
+        }
+        m_workers.reserve(m_queues.size());
+        for (std::size_t i = 0; i < m_queues.size(); ++i) {
+            m_workers.emplace_back([this, i]() { worker_loop(i); });
+        }
+    }
+
+    /// Finish the pending tasks and join the workers
+    ///
+    /// An exception of a task that no @c wait() rethrew is dropped.
+    ///
+    ~thread_pool() {
+        wait_pending();
+        {
+            std::lock_guard lock{m_sleep_mutex};
+            m_stop = true;
+        }
+        m_sleep_cv.notify_all();
+        for (auto& w : m_workers) {
+            w.join();
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /// Number of workers in the pool
+    std::size_t size() const { return m_workers.size(); }
+
+    /// Submit a task for execution
+    void submit(task_type task) {
+        task_type staged = [task = std::move(task),
+                            s = current_stage()](std::size_t worker) {
+            const scoped_current_stage stage_scope(s);
+            task(worker);
+        };
+        m_pending.fetch_add(1u);
+        m_queued.fetch_add(1u);
+        if (s_current_pool == this) {
+            m_queues[s_current_worker]->push_front(std::move(staged));
+        } else {
+            const std::size_t i = m_next_queue.fetch_add(1u) % m_queues.size();
+            m_queues[i]->push_back(std::move(staged));
+        }
+        {
+            // Taking the lock orders the notification after a concurrent
+            // worker's check of the queue counter.
+            std::lock_guard lock{m_sleep_mutex};
+        }
+        m_sleep_cv.notify_one();
+    }
+
+    /// Block until every submitted task has finished
+    ///
+    /// Must not be called from inside a task of the same pool.
+    ///
+    /// @throw The first exception thrown by a task since the last call
+    ///
+    void wait() {
+        wait_pending();
+        std::exception_ptr error;
+        {
+            std::lock_guard lock{m_done_mutex};
+            error = std::exchange(m_error, nullptr);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /// Run @c fn(i, worker) for every i in [0, n), and wait for it
+    ///
+    /// The calling thread takes part: it and up to @c size() helper tasks
+    /// claim indices from a shared counter until none are left. Unlike
+    /// @c wait, this only waits for its own work, so it may be called from
+    /// inside a task of the same pool. The calling thread never runs
+    /// unrelated tasks while waiting, so per-worker state of an outer task
+    /// is never used re-entrantly.
+    ///
+    /// @c worker is the index of the executing worker, or @c size() for a
+    /// calling thread outside of the pool.
+    ///
+    /// If @c fn throws, the indices not started yet are skipped, and the
+    /// first exception is rethrown once the started ones are done.
+    ///
+    template <typename function_t>
+    void parallel_for(std::size_t n, const function_t& fn) {
+
+        // Helpers may start after all indices are done; the counters are
+        // shared with them, while @c fn is only used for claimed indices.
+        struct shared_state {
+            std::atomic<std::size_t> next{0u};
+            std::atomic<std::size_t> remaining{0u};
+            std::atomic<bool> failed{false};
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::condition_variable cv;
+        };
+        auto state = std::make_shared<shared_state>();
+        state->remaining.store(n);
+        const auto work = [&fn](shared_state& st, std::size_t n_items,
+                                std::size_t worker) {
+            for (std::size_t i = st.next.fetch_add(1u); i < n_items;
+                 i = st.next.fetch_add(1u)) {
+                if (!st.failed.load()) {
+                    try {
+                        fn(i, worker);
+                    } catch (...) {
+                        std::lock_guard lock{st.mutex};
+                        if (!st.error) {
+                            st.error = std::current_exception();
+                        }
+                        st.failed.store(true);
+                    }
+                }
+                if (st.remaining.fetch_sub(1u) == 1u) {
+                    std::lock_guard lock{st.mutex};
+                    st.cv.notify_all();
+                }
+            }
+        };
+
+        const std::size_t n_helpers =
+            std::min(n, size() + 1u) - std::min<std::size_t>(n, 1u);
+        for (std::size_t h = 0; h < n_helpers; ++h) {
+            submit([state, n, work](std::size_t worker) {
+                work(*state, n, worker);
+            });
+        }
+        work(*state, n, (s_current_pool == this) ? s_current_worker : size());
+
+        std::unique_lock lock{state->mutex};
+        state->cv.wait(lock,
+                       [&state]() { return state->remaining.load() == 0u; });
+        if (state->error) {
+            std::rethrow_exception(state->error);
+        }
+    }
+
+    private:
+    /// Mutex-protected task deque of one worker
+    class worker_queue {
+        public:
+        void push_front(task_type task) {
+            std::lock_guard lock{m_mutex};
+            m_tasks.push_front(std::move(task));
+        }
+        void push_back(task_type task) {
+            std::lock_guard lock{m_mutex};
+            m_tasks.push_back(std::move(task));
+        }
+        /// Take a task from the owner's end
+        bool pop_front(task_type& task) {
+            std::lock_guard lock{m_mutex};
+            if (m_tasks.empty()) {
+                return false;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            return true;
+        }
+        /// Take a task from the thieves' end
+        bool steal_back(task_type& task) {
+            std::lock_guard lock{m_mutex};
+            if (m_tasks.empty()) {
+                return false;
+            }
+            task = std::move(m_tasks.back());
+            m_tasks.pop_back();
+            return true;
+        }
+
+        private:
+        std::mutex m_mutex;
+        std::deque<task_type> m_tasks;
+    };
+
+    /// Block until every submitted task has finished, without rethrowing
+    void wait_pending() {
+        std::unique_lock lock{m_done_mutex};
+        m_done_cv.wait(lock, [this]() { return m_pending.load() == 0u; });
+    }
+
+    /// Find a task for worker @c index, from its own deque or by stealing
+    bool find_task(std::size_t index, task_type& task) {
+        if (m_queues[index]->pop_front(task)) {
+            return true;
+        }
+        for (std::size_t i = 1; i < m_queues.size(); ++i) {
+            if (m_queues[(index + i) % m_queues.size()]->steal_back(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Main loop of worker @c index
+    void worker_loop(std::size_t index) {
+        s_current_pool = this;
+        s_current_worker = index;
+        task_type task;
+        while (true) {
+            if (find_task(index, task)) {
+                m_queued.fetch_sub(1u);
+                try {
+                    task(index);
+                } catch (...) {
+                    std::lock_guard lock{m_done_mutex};
+                    if (!m_error) {
+                        m_error = std::current_exception();
+                    }
+                }
+                task = nullptr;
+                if (m_pending.fetch_sub(1u) == 1u) {
+                    std::lock_guard lock{m_done_mutex};
+                    m_done_cv.notify_all();
+                }
+                continue;
+            }
+            std::unique_lock lock{m_sleep_mutex};
+            m_sleep_cv.wait(lock, [this]() {
+                return m_stop || m_queued.load() > 0u;
+            });
+            if (m_stop && m_queued.load() == 0u) {
+                return;
+            }
+        }
+    }
+
+    /// Task deques, one per worker
+    std::vector<std::unique_ptr<worker_queue>> m_queues;
+    /// The worker threads
+    std::vector<std::thread> m_workers;
+
+    /// Tasks submitted but not finished yet
+    std::atomic<std::size_t> m_pending{0u};
+    /// Tasks sitting in one of the deques
+    std::atomic<std::size_t> m_queued{0u};
+    /// Round-robin counter for tasks submitted from outside the pool
+    std::atomic<std::size_t> m_next_queue{0u};
+
+    /// @name Sleeping of idle workers
+    /// @{
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_sleep_cv;
+    bool m_stop = false;
+    /// @}
+
+    /// @name Waiting for all tasks to finish
+    /// @{
+    std::mutex m_done_mutex;
+    std::condition_variable m_done_cv;
+    /// First exception thrown by a task since the last @c wait()
+    std::exception_ptr m_error;
+    /// @}
+
+    /// Pool of the worker running on the current thread, if any
+    static inline thread_local thread_pool* s_current_pool = nullptr;
+    /// Index of the worker running on the current thread
+    static inline thread_local std::size_t s_current_worker = 0u;
+
+};  // class thread_pool
+
+}  // namespace traccc::tutorial
@@ -0,0 +1,841 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/batched_kalman_fitter.hpp"
+#include "common/bounded_queue.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/track_state.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// POSIX include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace traccc::tutorial {
+
+/// Parametrization of the fitted parameters of the tracks of an event
+enum class track_parametrization : std::uint32_t {
+    /// traccc's bound parameters: loc0, loc1, phi, theta, q/p, time
+    bound = 0u,
+    /// The batched fitter's parameters on its reference plane: y, z,
+    /// dy/dx, dz/dx, q/p, and the x of the plane
+    telescope = 1u
+};
+
+/// Encoding of the columns of a track state file
+enum class track_file_compression : std::uint32_t {
+    /// The column bytes as they are
+    none = 0u,
+    /// The bytes of the elements regrouped by significance, and then
+    /// run-length encoded
+    shuffle_rle = 1u
+};
+
+/// The fitted tracks of one event, column by column
+///
+/// Track columns have one entry per track, state columns one entry per
+/// track state, with the states of a track following each other. All values
+/// are stored in single precision.
+///
+struct track_state_table {
+
+    /// Number of the event
+    std::uint64_t event = 0u;
+    /// Meaning of @c params and @c covariance
+    track_parametrization parametrization = track_parametrization::bound;
+
+    /// @name Track columns
+    /// @{
+    std::vector<float> chi2;
+    std::vector<float> ndf;
+    /// Number of states of every track
+    std::vector<std::uint32_t> n_states;
+    /// Barcode of the surface of the fitted parameters
+    std::vector<std::uint64_t> surface;
+    std::vector<std::array<float, 6>> params;
+    /// Upper triangle of the covariance, row by row
+    std::vector<std::array<float, 21>> covariance;
+    /// @}
+
+    /// @name State columns
+    /// @{
+    /// Barcode of the surface of the state
+    std::vector<std::uint64_t> state_surface;
+    /// Local position of the measurement
+    std::vector<std::array<float, 2>> state_local;
+    /// Measurement minus smoothed local position
+    std::vector<std::array<float, 2>> state_residual;
+    /// Smoothed chi2 of the state
+    std::vector<float> state_chi2;
+    /// Whether the state is a hole
+    std::vector<std::uint8_t> state_hole;
+    /// @}
+
+    /// Number of tracks
+    std::size_t n_tracks() const { return chi2.size(); }
+};
+
+/// Columns of the tracks fitted by traccc's Kalman fitter
+inline track_state_table make_track_state_table(
+    std::uint64_t event,
+    const track_state_container_types::host& track_states) {
+
+    track_state_table table;
+    table.event = event;
+    table.parametrization = track_parametrization::bound;
+    for (std::size_t i = 0; i < track_states.size(); ++i) {
+        const auto& fit = track_states.at(i).header;
+        const auto& states = track_states.at(i).items;
+        table.chi2.push_back(static_cast<float>(fit.chi2));
+        table.ndf.push_back(static_cast<float>(fit.ndf));
+        table.n_states.push_back(static_cast<std::uint32_t>(states.size()));
+        table.surface.push_back(fit.fit_params.surface_link().value());
+        std::array<float, 6> params{};
+        std::array<float, 21> covariance{};
+        for (unsigned int a = 0, k = 0; a < e_bound_size; ++a) {
+            params[a] = static_cast<float>(
+                getter::element(fit.fit_params.vector(), a, 0u));
+            for (unsigned int b = a; b < e_bound_size; ++b, ++k) {
+                covariance[k] = static_cast<float>(
+                    getter::element(fit.fit_params.covariance(), a, b));
+            }
+        }
+        table.params.push_back(params);
+        table.covariance.push_back(covariance);
+
+        for (const auto& state : states) {
+            const auto& meas = state.get_measurement();
+            const auto smoothed = state.smoothed().bound_local();
+            table.state_surface.push_back(state.surface_link().value());
+            table.state_local.push_back({static_cast<float>(meas.local[0]),
+                                         static_cast<float>(meas.local[1])});
+            table.state_residual.push_back(
+                {static_cast<float>(meas.local[0] - smoothed[0]),
+                 static_cast<float>(meas.local[1] - smoothed[1])});
+            table.state_chi2.push_back(
+                static_cast<float>(state.smoothed_chi2()));
+            table.state_hole.push_back(state.is_hole ? 1u : 0u);
+        }
+    }
+    return table;
+}
+
+/// Columns of the tracks fitted by @c batched_kalman_fitter
+///
+/// The batched fitter only keeps the smoothed result on its reference
+/// plane, so the tracks have no states.
+///
+template <typename scalar_t>
+track_state_table make_track_state_table(
+    std::uint64_t event,
+    const std::vector<batched_fit_result<scalar_t>>& results) {
+
+    track_state_table table;
+    table.event = event;
+    table.parametrization = track_parametrization::telescope;
+    for (const auto& fit : results) {
+        table.chi2.push_back(static_cast<float>(fit.chi2));
+        table.ndf.push_back(static_cast<float>(fit.ndf));
+        table.n_states.push_back(0u);
+        table.surface.push_back(0u);
+        std::array<float, 6> params{};
+        std::array<float, 21> covariance{};
+        for (std::size_t a = 0, k = 0; a < 6u; ++a) {
+            params[a] = static_cast<float>(a < 5u ? fit.params[a] : fit.x);
+            for (std::size_t b = a; b < 6u; ++b, ++k) {
+                covariance[k] =
+                    (b < 5u) ? static_cast<float>(fit.covariance[a * 5u + b])
+                             : 0.f;
+            }
+        }
+        table.params.push_back(params);
+        table.covariance.push_back(covariance);
+    }
+    return table;
+}
+
+namespace details {
+
+/// Columns of a track state file, in the order of @c track_state_table
+enum class track_column : std::size_t {
+    chi2 = 0,
+    ndf,
+    n_states,
+    surface,
+    params,
+    covariance,
+    state_surface,
+    state_local,
+    state_residual,
+    state_chi2,
+    state_hole,
+    n_columns
+};
+
+/// Number of columns in a track state block
+inline constexpr std::size_t n_track_columns =
+    static_cast<std::size_t>(track_column::n_columns);
+
+/// Columns with one entry per track; the others have one per state
+inline constexpr std::size_t n_per_track_columns = 6u;
+
+/// Size of the elements of every column
+inline constexpr std::array<std::uint32_t, n_track_columns>
+    track_column_sizes{sizeof(float),
+                       sizeof(float),
+                       sizeof(std::uint32_t),
+                       sizeof(std::uint64_t),
+                       sizeof(std::array<float, 6>),
+                       sizeof(std::array<float, 21>),
+                       sizeof(std::uint64_t),
+                       sizeof(std::array<float, 2>),
+                       sizeof(std::array<float, 2>),
+                       sizeof(float),
+                       sizeof(std::uint8_t)};
+
+/// Call @c f with every column of a (possibly const) table, in file order
+template <typename table_t, typename function_t>
+void for_each_track_column(table_t& table, function_t&& f) {
+    f(track_column::chi2, table.chi2);
+    f(track_column::ndf, table.ndf);
+    f(track_column::n_states, table.n_states);
+    f(track_column::surface, table.surface);
+    f(track_column::params, table.params);
+    f(track_column::covariance, table.covariance);
+    f(track_column::state_surface, table.state_surface);
+    f(track_column::state_local, table.state_local);
+    f(track_column::state_residual, table.state_residual);
+    f(track_column::state_chi2, table.state_chi2);
+    f(track_column::state_hole, table.state_hole);
+}
+
+/// Alignment of the event blocks and of the columns inside them
+inline constexpr std::size_t track_file_alignment = 64u;
+
+/// Round @c value up to the column alignment
+inline constexpr std::uint64_t track_file_align_up(std::uint64_t value) {
+    return (value + track_file_alignment - 1u) & ~(track_file_alignment - 1u);
+}
+
+/// Header at the start of a track state file
+struct track_file_header {
+    /// File identifier
+    char magic[8];
+    /// Number of events in the file
+    std::uint64_t n_events;
+    /// Offset of the event index (one @c track_block_entry per event)
+    std::uint64_t index_offset;
+    /// Element size of every column, to refuse files of another layout
+    std::array<std::uint32_t, n_track_columns> column_sizes;
+};
+
+/// Location and encoding of one column of an event block
+struct track_column_entry {
+    /// Offset of the column from the start of the block
+    std::uint64_t offset;
+    /// Number of bytes stored for the column
+    std::uint64_t stored_size;
+    /// @c track_file_compression of the column
+    std::uint32_t encoding;
+    std::uint32_t padding;
+};
+
+/// Location of one event block in a track state file
+struct track_block_entry {
+    /// Number of the event
+    std::uint64_t event;
+    /// Offset of the block in the file
+    std::uint64_t offset;
+    /// Number of tracks in the event
+    std::uint64_t n_tracks;
+    /// Number of track states in the event
+    std::uint64_t n_states;
+    /// @c track_parametrization of the event
+    std::uint32_t parametrization;
+    std::uint32_t padding;
+    /// The columns
+    std::array<track_column_entry, n_track_columns> columns;
+};
+
+/// Magic bytes of a track state file
+inline constexpr char track_file_magic[8] = {'T', 'U', 'T', 'T',
+                                             'R', 'K', 'S', '1'};
+
+/// Regroup the bytes of @c n elements of @c size bytes by significance
+inline void byte_shuffle(const std::byte* in, std::size_t n,
+                         std::size_t size, std::byte* out) {
+    for (std::size_t b = 0; b < size; ++b) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[b * n + i] = in[i * size + b];
+        }
+    }
+}
+
+/// Undo @c byte_shuffle
+inline void byte_unshuffle(const std::byte* in, std::size_t n,
+                           std::size_t size, std::byte* out) {
+    for (std::size_t b = 0; b < size; ++b) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i * size + b] = in[b * n + i];
+        }
+    }
+}
+
+/// Run-length encode @c n bytes, appending to @c out
+///
+/// A control byte below 128 is followed by (control + 1) literal bytes;
+/// one of 128 or above by one byte that is repeated (control - 125) times.
+///
+inline void rle_encode(const std::byte* in, std::size_t n,
+                       std::vector<std::byte>& out) {
+    std::size_t i = 0;
+    while (i < n) {
+        std::size_t run = 1u;
+        while (i + run < n && run < 130u && in[i + run] == in[i]) {
+            ++run;
+        }
+        if (run >= 3u) {
+            out.push_back(static_cast<std::byte>(125u + run));
+            out.push_back(in[i]);
+            i += run;
+            continue;
+        }
+        // Literals, up to the next run of three
+        const std::size_t start = i;
+        std::size_t length = 0u;
+        while (i < n && length < 128u &&
+               !(i + 2u < n && in[i] == in[i + 1u] && in[i] == in[i + 2u])) {
+            ++i;
+            ++length;
+        }
+        out.push_back(static_cast<std::byte>(length - 1u));
+        out.insert(out.end(), in + start, in + start + length);
+    }
+}
+
+/// Largest number of bytes that @c rle_decode writes per input byte (a run
+/// of 130 bytes from two)
+inline constexpr std::uint64_t rle_max_expansion = 65u;
+
+/// Decode @c rle_encode output into exactly @c n bytes
+inline void rle_decode(const std::byte* in, std::size_t in_size,
+                       std::byte* out, std::size_t n) {
+    std::size_t i = 0, o = 0;
+    while (i < in_size) {
+        const auto control = static_cast<std::size_t>(in[i++]);
+        const std::size_t length =
+            (control < 128u) ? control + 1u : control - 125u;
+        if (o + length > n || i + (control < 128u ? length : 1u) > in_size) {
+            throw std::runtime_error("Corrupt track state column");
+        }
+        if (control < 128u) {
+            std::memcpy(out + o, in + i, length);
+            i += length;
+        } else {
+            std::fill_n(out + o, length, in[i++]);
+        }
+        o += length;
+    }
+    if (o != n) {
+        throw std::runtime_error("Corrupt track state column");
+    }
+}
+
+}  // namespace details
+
+/// Writer of columnar binary track state files
+///
+/// Every event is stored as one block of 64-byte aligned columns, one per
+/// member of @c track_state_table, followed at the end of the file by an
+/// index of the blocks, as in the cell files of @c cell_file_writer. With
+/// @c track_file_compression::shuffle_rle, the bytes of every column are
+/// regrouped by significance, so that the sign and exponent bytes of the
+/// floats, and the high bytes of the integers, form long runs, and are then
+/// run-length encoded. A column that would not get smaller is stored as is.
+///
+/// @c write() only copies the tracks into a table and queues it. Encoding
+/// and writing happen on a background thread, so the reconstruction does not
+/// wait for the disk unless the queue is full. Any number of threads may
+/// call @c write() at the same time; the events are stored in the order in
+/// which they were queued, and each block records its event number.
+///
+class track_state_file_writer {
+
+    public:
+    /// Create (or truncate) the file at @c path
+    ///
+    /// @param path           The output file
+    /// @param compression    Encoding of the columns
+    /// @param queue_capacity Events that may wait for the background thread
+    ///
+    explicit track_state_file_writer(
+        const std::string& path,
+        track_file_compression compression = track_file_compression::none,
+        std::size_t queue_capacity = 8u)
+        : m_out(path, std::ios::binary | std::ios::trunc),
+          m_compression(compression),
+          m_queue(queue_capacity) {
+        if (!m_out) {
+            throw std::runtime_error("Could not create " + path);
+        }
+        details::track_file_header header{};
+        m_out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_offset = sizeof(header);
+        m_thread = std::thread([this]() { run(); });
+    }
+
+    /// Finish the file, if that was not done explicitly
+    ~track_state_file_writer() {
+        if (m_thread.joinable()) {
+            try {
+                close();
+            } catch (...) {
+            }
+        }
+    }
+
+    track_state_file_writer(const track_state_file_writer&) = delete;
+    track_state_file_writer& operator=(const track_state_file_writer&) =
+        delete;
+
+    /// Queue the tracks of one event
+    void write(track_state_table table) {
+        if (!m_queue.push(
+                std::make_unique<track_state_table>(std::move(table)))) {
+            throw std::logic_error("Track state file written after close()");
+        }
+    }
+
+    /// Queue the tracks fitted by traccc's Kalman fitter
+    void write(std::uint64_t event,
+               const track_state_container_types::host& track_states) {
+        write(make_track_state_table(event, track_states));
+    }
+
+    /// Queue the tracks fitted by @c batched_kalman_fitter
+    template <typename scalar_t>
+    void write(std::uint64_t event,
+               const std::vector<batched_fit_result<scalar_t>>& results) {
+        write(make_track_state_table(event, results));
+    }
+
+    /// Write the queued events, the event index and the final header
+    ///
+    /// No thread may call @c write() any more. Errors of the background
+    /// thread are rethrown here.
+    ///
+    void close() {
+
+        m_queue.close();
+        m_thread.join();
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+
+        pad_to(details::track_file_align_up(m_offset));
+        details::track_file_header header{};
+        std::memcpy(header.magic, details::track_file_magic,
+                    sizeof(header.magic));
+        header.n_events = m_index.size();
+        header.index_offset = m_offset;
+        header.column_sizes = details::track_column_sizes;
+        write_bytes(m_index.data(),
+                    m_index.size() * sizeof(details::track_block_entry));
+
+        m_out.seekp(0);
+        m_out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_out.close();
+        if (m_out.fail()) {
+            throw std::runtime_error("Could not write the track state file");
+        }
+    }
+
+    /// Size of the file, once it was closed
+    std::uint64_t bytes_written() const { return m_offset; }
+
+    private:
+    /// Body of the background thread
+    void run() {
+        while (auto table = m_queue.pop()) {
+            // After an error, keep draining, so that write() never blocks.
+            if (m_error) {
+                continue;
+            }
+            try {
+                write_table(**table);
+            } catch (...) {
+                m_error = std::current_exception();
+            }
+        }
+    }
+
+    /// Write the block of one event
+    void write_table(const track_state_table& table) {
+
+        pad_to(details::track_file_align_up(m_offset));
+        details::track_block_entry entry{};
+        entry.event = table.event;
+        entry.offset = m_offset;
+        entry.n_tracks = table.n_tracks();
+        entry.n_states = table.state_surface.size();
+        entry.parametrization =
+            static_cast<std::uint32_t>(table.parametrization);
+
+        const auto write_column = [&](details::track_column c,
+                                      const auto& column) {
+            const auto i = static_cast<std::size_t>(c);
+            pad_to(details::track_file_align_up(m_offset));
+            auto& col = entry.columns[i];
+            col.offset = m_offset - entry.offset;
+            const auto* data =
+                reinterpret_cast<const std::byte*>(column.data());
+            const std::size_t size = details::track_column_sizes[i];
+            const std::size_t bytes = column.size() * size;
+
+            col.encoding =
+                static_cast<std::uint32_t>(track_file_compression::none);
+            if (m_compression == track_file_compression::shuffle_rle &&
+                bytes > 0u) {
+                m_shuffled.resize(bytes);
+                details::byte_shuffle(data, column.size(), size,
+                                      m_shuffled.data());
+                m_encoded.clear();
+                details::rle_encode(m_shuffled.data(), bytes, m_encoded);
+                if (m_encoded.size() < bytes) {
+                    col.encoding = static_cast<std::uint32_t>(
+                        track_file_compression::shuffle_rle);
+                    col.stored_size = m_encoded.size();
+                    write_bytes(m_encoded.data(), m_encoded.size());
+                    return;
+                }
+            }
+            col.stored_size = bytes;
+            write_bytes(data, bytes);
+        };
+        details::for_each_track_column(table, write_column);
+        if (m_out.fail()) {
+            throw std::runtime_error("Could not write the track state file");
+        }
+        m_index.push_back(entry);
+    }
+
+    void write_bytes(const void* ptr, std::uint64_t size) {
+        m_out.write(static_cast<const char*>(ptr),
+                    static_cast<std::streamsize>(size));
+        m_offset += size;
+    }
+    void pad_to(std::uint64_t offset) {
+        static constexpr char zeros[details::track_file_alignment] = {};
+        write_bytes(zeros, offset - m_offset);
+    }
+
+    /// The output file
+    std::ofstream m_out;
+    /// Encoding of the columns
+    track_file_compression m_compression;
+    /// Current write offset
+    std::uint64_t m_offset = 0;
+    /// Index of the written event blocks
+    std::vector<details::track_block_entry> m_index;
+    /// Scratch buffers of the encoding
+    std::vector<std::byte> m_shuffled, m_encoded;
+    /// Events waiting for the background thread
+    bounded_queue<std::unique_ptr<track_state_table>> m_queue;
+    /// First error of the background thread
+    std::exception_ptr m_error;
+    /// The background thread
+    std::thread m_thread;
+
+};  // class track_state_file_writer
+
+/// The fitted tracks of one event, read from a track state file
+///
+/// The columns are spans of the mapped file. Only columns that were stored
+/// compressed are decoded, into buffers owned by this object.
+///
+class track_state_event {
+
+    public:
+    track_state_event() = default;
+    // The columns may point into the decoded buffers, which a copy would not
+    // share.
+    track_state_event(const track_state_event&) = delete;
+    track_state_event& operator=(const track_state_event&) = delete;
+    track_state_event(track_state_event&&) = default;
+    track_state_event& operator=(track_state_event&&) = default;
+
+    /// Number of the event
+    std::uint64_t event() const { return m_event; }
+    /// Meaning of @c params and @c covariance
+    track_parametrization parametrization() const {
+        return m_parametrization;
+    }
+    /// Number of tracks
+    std::size_t n_tracks() const { return m_n_tracks; }
+    /// Number of track states
+    std::size_t n_states() const { return m_n_states; }
+
+    /// @name Track columns, as in @c track_state_table
+    /// @{
+    std::span<const float> chi2() const {
+        return column<float>(details::track_column::chi2);
+    }
+    std::span<const float> ndf() const {
+        return column<float>(details::track_column::ndf);
+    }
+    std::span<const std::uint32_t> n_states_per_track() const {
+        return column<std::uint32_t>(details::track_column::n_states);
+    }
+    std::span<const std::uint64_t> surface() const {
+        return column<std::uint64_t>(details::track_column::surface);
+    }
+    std::span<const std::array<float, 6>> params() const {
+        return column<std::array<float, 6>>(details::track_column::params);
+    }
+    std::span<const std::array<float, 21>> covariance() const {
+        return column<std::array<float, 21>>(
+            details::track_column::covariance);
+    }
+    /// @}
+
+    /// @name State columns, as in @c track_state_table
+    /// @{
+    std::span<const std::uint64_t> state_surface() const {
+        return column<std::uint64_t>(details::track_column::state_surface);
+    }
+    std::span<const std::array<float, 2>> state_local() const {
+        return column<std::array<float, 2>>(
+            details::track_column::state_local);
+    }
+    std::span<const std::array<float, 2>> state_residual() const {
+        return column<std::array<float, 2>>(
+            details::track_column::state_residual);
+    }
+    std::span<const float> state_chi2() const {
+        return column<float>(details::track_column::state_chi2);
+    }
+    std::span<const std::uint8_t> state_hole() const {
+        return column<std::uint8_t>(details::track_column::state_hole);
+    }
+    /// @}
+
+    private:
+    friend class track_state_file_reader;
+
+    template <typename T>
+    std::span<const T> column(details::track_column c) const {
+        const auto i = static_cast<std::size_t>(c);
+        return {reinterpret_cast<const T*>(m_columns[i]),
+                i < details::n_per_track_columns ? m_n_tracks : m_n_states};
+    }
+
+    std::uint64_t m_event = 0u;
+    track_parametrization m_parametrization = track_parametrization::bound;
+    std::size_t m_n_tracks = 0u;
+    std::size_t m_n_states = 0u;
+    /// Start of every column, in the mapping or in @c m_decoded
+    std::array<const std::byte*, details::n_track_columns> m_columns{};
+    /// Decoded compressed columns
+    std::array<std::vector<std::byte>, details::n_track_columns> m_decoded;
+
+};  // class track_state_event
+
+/// Reader of columnar binary track state files
+///
+/// The file is memory-mapped. Uncompressed columns are used in place, and
+/// accessing an event asks the kernel to read the next event block
+/// asynchronously. The reader is immutable after construction, so it can be
+/// shared by any number of threads.
+///
+class track_state_file_reader {
+
+    public:
+    /// Map the track state file at @c path
+    explicit track_state_file_reader(const std::string& path) {
+
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open " + path);
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Could not stat " + path);
+        }
+        m_size = static_cast<std::size_t>(st.st_size);
+        void* ptr = (m_size >= sizeof(details::track_file_header))
+                        ? ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0)
+                        : MAP_FAILED;
+        ::close(fd);
+        if (ptr == MAP_FAILED) {
+            throw std::runtime_error("Could not map " + path);
+        }
+        m_data = static_cast<const std::byte*>(ptr);
+
+        const auto& header =
+            *reinterpret_cast<const details::track_file_header*>(m_data);
+        if (std::memcmp(header.magic, details::track_file_magic,
+                        sizeof(header.magic)) != 0 ||
+            header.column_sizes != details::track_column_sizes) {
+            ::munmap(ptr, m_size);
+            throw std::runtime_error(path +
+                                     " is not a compatible track state file");
+        }
+        m_n_events = header.n_events;
+        m_index = reinterpret_cast<const details::track_block_entry*>(
+            m_data + header.index_offset);
+        if (!valid(header)) {
+            ::munmap(ptr, m_size);
+            throw std::runtime_error(path + " is truncated or corrupt");
+        }
+    }
+
+    /// Unmap the file; events handed out must not be used afterwards
+    ~track_state_file_reader() {
+        ::munmap(const_cast<std::byte*>(m_data), m_size);
+    }
+
+    track_state_file_reader(const track_state_file_reader&) = delete;
+    track_state_file_reader& operator=(const track_state_file_reader&) =
+        delete;
+
+    /// Number of events in the file
+    std::size_t size() const { return m_n_events; }
+
+    /// The tracks of the @c i-th event block
+    track_state_event event(std::size_t i) const {
+
+        if (i + 1u < m_n_events) {
+            const auto& next = m_index[i + 1u];
+            const auto& last = next.columns.back();
+            const std::size_t page =
+                static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            const std::size_t first = next.offset & ~(page - 1u);
+            ::madvise(const_cast<std::byte*>(m_data) + first,
+                      next.offset + last.offset + last.stored_size - first,
+                      MADV_WILLNEED);
+        }
+
+        const auto& entry = m_index[i];
+        track_state_event result;
+        result.m_event = entry.event;
+        result.m_parametrization =
+            static_cast<track_parametrization>(entry.parametrization);
+        result.m_n_tracks = entry.n_tracks;
+        result.m_n_states = entry.n_states;
+        const std::byte* block = m_data + entry.offset;
+        for (std::size_t c = 0; c < details::n_track_columns; ++c) {
+            const auto& col = entry.columns[c];
+            const std::size_t n = (c < details::n_per_track_columns)
+                                      ? entry.n_tracks
+                                      : entry.n_states;
+            const std::size_t size = details::track_column_sizes[c];
+            if (col.encoding ==
+                static_cast<std::uint32_t>(track_file_compression::none)) {
+                result.m_columns[c] = block + col.offset;
+                continue;
+            }
+            std::vector<std::byte> shuffled(n * size);
+            details::rle_decode(block + col.offset, col.stored_size,
+                                shuffled.data(), shuffled.size());
+            result.m_decoded[c].resize(n * size);
+            details::byte_unshuffle(shuffled.data(), n, size,
+                                    result.m_decoded[c].data());
+            result.m_columns[c] = result.m_decoded[c].data();
+        }
+        return result;
+    }
+
+    private:
+    /// Whether the index and every column of every event block lie inside
+    /// the file, with sizes that match the number of tracks and states
+    ///
+    /// The comparisons are written so that corrupt offsets and sizes can
+    /// not overflow them.
+    ///
+    bool valid(const details::track_file_header& header) const {
+
+        using entry_type = details::track_block_entry;
+        if (header.index_offset > m_size ||
+            header.index_offset % alignof(entry_type) != 0u ||
+            header.n_events >
+                (m_size - header.index_offset) / sizeof(entry_type)) {
+            return false;
+        }
+        for (std::size_t i = 0; i < m_n_events; ++i) {
+            const entry_type& entry = m_index[i];
+            if (entry.offset > m_size ||
+                entry.offset % details::track_file_alignment != 0u) {
+                return false;
+            }
+            const std::uint64_t block_size = m_size - entry.offset;
+            for (std::size_t c = 0; c < details::n_track_columns; ++c) {
+                const auto& col = entry.columns[c];
+                const std::uint64_t n = (c < details::n_per_track_columns)
+                                            ? entry.n_tracks
+                                            : entry.n_states;
+                const std::uint64_t size = details::track_column_sizes[c];
+                if (col.offset > block_size ||
+                    col.stored_size > block_size - col.offset) {
+                    return false;
+                }
+                if (col.encoding == static_cast<std::uint32_t>(
+                                        track_file_compression::none)) {
+                    // Used in place, so it must be aligned and complete
+                    if (col.offset % details::track_file_alignment != 0u ||
+                        n > col.stored_size / size ||
+                        n * size != col.stored_size) {
+                        return false;
+                    }
+                } else if (col.encoding !=
+                               static_cast<std::uint32_t>(
+                                   track_file_compression::shuffle_rle) ||
+                           n > col.stored_size *
+                                   details::rle_max_expansion / size) {
+                    // The run-length encoding can not expand further, so
+                    // this bounds what event() allocates.
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// The mapped file
+    const std::byte* m_data = nullptr;
+    /// Size of the mapped file
+    std::size_t m_size = 0;
+    /// Number of events in the file
+    std::size_t m_n_events = 0;
+    /// Index of the event blocks
+    const details::track_block_entry* m_index = nullptr;
+
+};  // class track_state_file_reader
+
+}  // namespace traccc::tutorial
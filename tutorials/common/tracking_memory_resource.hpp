@@ -0,0 +1,257 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/stage_timer.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+
+namespace traccc::tutorial {
+
+/// Allocations of one reconstruction stage through a memory resource
+struct memory_stage_statistics {
+    /// Number of allocations
+    std::size_t n_allocations = 0;
+    /// Bytes allocated
+    std::size_t bytes_allocated = 0;
+    /// Bytes of the stage alive when the statistics were taken
+    std::size_t live_bytes = 0;
+    /// Highest number of bytes of the stage alive at the same time
+    std::size_t peak_live_bytes = 0;
+    /// Highest number of bytes of all stages alive at the same time, while
+    /// this stage allocated
+    std::size_t peak_total_bytes = 0;
+    /// Bytes that the stage allocated in an event beyond its peak in that
+    /// event, summed over the events
+    std::size_t fragmented_bytes = 0;
+
+    /// Share of the allocated bytes beyond the peaks of their events
+    ///
+    /// This is the space that a monotonic allocator, such as
+    /// @c arena_memory_resource, holds without being able to reuse it
+    /// before the end of the event.
+    ///
+    double fragmentation() const {
+        return bytes_allocated > 0u
+                   ? static_cast<double>(fragmented_bytes) /
+                         static_cast<double>(bytes_allocated)
+                   : 0.;
+    }
+
+    /// Accumulate the statistics of another resource
+    ///
+    /// The resources are taken to be used at the same time, by different
+    /// workers, so their peaks add up: the result is the memory that the
+    /// workers need when they all reach their peaks together.
+    ///
+    memory_stage_statistics& operator+=(
+        const memory_stage_statistics& other) {
+        n_allocations += other.n_allocations;
+        bytes_allocated += other.bytes_allocated;
+        live_bytes += other.live_bytes;
+        peak_live_bytes += other.peak_live_bytes;
+        peak_total_bytes += other.peak_total_bytes;
+        fragmented_bytes += other.fragmented_bytes;
+        return *this;
+    }
+};
+
+/// Allocation statistics per stage, with a last entry for the allocations
+/// made outside of all stages (e.g. the generated cells)
+using memory_statistics =
+    std::array<memory_stage_statistics, n_stages + 1u>;
+
+/// Accumulate the statistics of another, concurrently used resource
+inline memory_statistics& operator+=(memory_statistics& lhs,
+                                     const memory_statistics& rhs) {
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        lhs[i] += rhs[i];
+    }
+    return lhs;
+}
+
+/// Memory resource that attributes its allocations to the current stage
+///
+/// Every allocation is passed on to the upstream resource, and counted for
+/// the @c current_stage() of the allocating thread. Deallocations are
+/// counted for the stage that made the allocation, however late they come,
+/// so the live bytes of e.g. the measurements stay with the clusterization
+/// until the event is done.
+///
+/// Allocations are tracked in a hash map behind a mutex. That is meant for
+/// a profiling run, not for production.
+///
+class tracking_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Track the allocations from @c upstream
+    explicit tracking_memory_resource(vecmem::memory_resource& upstream)
+        : m_upstream(upstream) {}
+
+    tracking_memory_resource(const tracking_memory_resource&) = delete;
+    tracking_memory_resource& operator=(const tracking_memory_resource&) =
+        delete;
+
+    /// Mark the end of an event
+    ///
+    /// The fragmentation is measured per event. Without calls to this
+    /// function, the whole run counts as one event.
+    ///
+    void next_event() {
+        std::lock_guard lock{m_mutex};
+        for (std::size_t i = 0; i < m_stages.size(); ++i) {
+            close_event(i);
+        }
+    }
+
+    /// Statistics of all allocations so far
+    memory_statistics statistics() const {
+        std::lock_guard lock{m_mutex};
+        memory_statistics result;
+        for (std::size_t i = 0; i < m_stages.size(); ++i) {
+            const stage_state& s = m_stages[i];
+            result[i] = s.stats;
+            result[i].live_bytes = s.live_bytes;
+            result[i].fragmented_bytes += s.event_bytes - s.event_peak_bytes;
+        }
+        return result;
+    }
+
+    private:
+    /// Statistics of one stage, with its state in the current event
+    struct stage_state {
+        memory_stage_statistics stats;
+        std::size_t live_bytes = 0;
+        /// Live bytes left over from earlier events
+        std::size_t event_base_bytes = 0;
+        /// Bytes allocated in the current event
+        std::size_t event_bytes = 0;
+        /// Highest live bytes of the current event
+        std::size_t event_peak_bytes = 0;
+    };
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+
+        void* ptr = m_upstream.allocate(bytes, alignment);
+        const auto i = static_cast<std::size_t>(current_stage());
+        std::lock_guard lock{m_mutex};
+        m_owner.emplace(ptr, i);
+        m_live_bytes += bytes;
+        stage_state& s = m_stages[i];
+        ++s.stats.n_allocations;
+        s.stats.bytes_allocated += bytes;
+        s.live_bytes += bytes;
+        s.event_bytes += bytes;
+        s.event_peak_bytes = std::max(
+            s.event_peak_bytes,
+            std::max(s.live_bytes, s.event_base_bytes) - s.event_base_bytes);
+        s.stats.peak_live_bytes =
+            std::max(s.stats.peak_live_bytes, s.live_bytes);
+        s.stats.peak_total_bytes =
+            std::max(s.stats.peak_total_bytes, m_live_bytes);
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override {
+        {
+            std::lock_guard lock{m_mutex};
+            const auto it = m_owner.find(ptr);
+            if (it != m_owner.end()) {
+                m_stages[it->second].live_bytes -= bytes;
+                m_live_bytes -= bytes;
+                m_owner.erase(it);
+            }
+        }
+        m_upstream.deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    /// Start a new event for stage @c i
+    void close_event(std::size_t i) {
+        stage_state& s = m_stages[i];
+        s.stats.fragmented_bytes += s.event_bytes - s.event_peak_bytes;
+        s.event_bytes = 0;
+        s.event_peak_bytes = 0;
+        s.event_base_bytes = s.live_bytes;
+    }
+
+    /// The resource that serves the allocations
+    vecmem::memory_resource& m_upstream;
+    /// Guards all members below
+    mutable std::mutex m_mutex;
+    /// Stage of every live allocation
+    std::unordered_map<void*, std::size_t> m_owner;
+    /// Per-stage state, with the allocations outside of all stages last
+    std::array<stage_state, n_stages + 1u> m_stages{};
+    /// Bytes alive over all stages
+    std::size_t m_live_bytes = 0;
+
+};  // class tracking_memory_resource
+
+/// Print the per-stage allocations and peaks of a run
+///
+/// @param out      The stream to print to
+/// @param stats    Statistics accumulated over all resources of the run
+/// @param n_events Number of processed events
+///
+inline void print_memory_report(std::ostream& out,
+                                const memory_statistics& stats,
+                                std::size_t n_events) {
+
+    const double events =
+        static_cast<double>(std::max<std::size_t>(n_events, 1u));
+    constexpr double MB = 1024. * 1024.;
+    out << std::endl;
+    out << std::left << std::setw(22) << "stage" << std::right
+        << std::setw(12) << "allocs/evt" << std::setw(12) << "MB/evt"
+        << std::setw(12) << "peak [MB]" << std::setw(14) << "total [MB]"
+        << std::setw(10) << "frag" << std::endl;
+    for (std::size_t i = 0; i < stats.size(); ++i) {
+        const memory_stage_statistics& s = stats[i];
+        const std::string_view name =
+            i < n_stages ? stage_name(static_cast<stage>(i)) : "other";
+        out << std::left << std::setw(22) << name << std::right << std::fixed
+            << std::setprecision(1) << std::setw(12)
+            << static_cast<double>(s.n_allocations) / events
+            << std::setprecision(3) << std::setw(12)
+            << static_cast<double>(s.bytes_allocated) / MB / events
+            << std::setw(12) << static_cast<double>(s.peak_live_bytes) / MB
+            << std::setw(14) << static_cast<double>(s.peak_total_bytes) / MB
+            << std::setw(9) << std::setprecision(1)
+            << 100. * s.fragmentation() << "%" << std::endl;
+    }
+    out << std::defaultfloat << std::setprecision(6);
+    out << "peak:  highest live bytes of the stage, summed over the workers"
+        << std::endl
+        << "total: highest live bytes of all stages while the stage"
+        << " allocated, summed" << std::endl
+        << "       over the workers" << std::endl
+        << "frag:  share of the stage's bytes in an event beyond its peak in"
+        << " that event," << std::endl
+        << "       which a monotonic arena holds without reusing it"
+        << std::endl;
+}
+
+}  // namespace traccc::tutorial
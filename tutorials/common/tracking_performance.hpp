@@ -0,0 +1,221 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "common/event_generator.hpp"
+#include "common/reconstruction_chain.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/edm/measurement.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace traccc::tutorial {
+
+/// Physics performance of the chain, accumulated over events
+struct tracking_performance {
+
+    /// Particles with at least three hits
+    std::size_t n_particles = 0;
+    /// Of those, the particles matched by at least one fitted track
+    std::size_t n_found_particles = 0;
+    /// Fitted tracks
+    std::size_t n_tracks = 0;
+    /// Fitted tracks matched to a particle
+    std::size_t n_matched_tracks = 0;
+    /// Sum of chi2/NDF over the fitted tracks
+    double sum_chi2_ndf = 0.;
+    /// Sums of (p_fit - p_true) / p_true (and its square) over the matched
+    /// tracks
+    double sum_dp = 0.;
+    double sum_dp2 = 0.;
+
+    /// Fraction of the particles found
+    double efficiency() const {
+        return n_particles > 0u ? static_cast<double>(n_found_particles) /
+                                      static_cast<double>(n_particles)
+                                : 0.;
+    }
+    /// Mean chi2/NDF of the fitted tracks
+    double mean_chi2_ndf() const {
+        return n_tracks > 0u ? sum_chi2_ndf / static_cast<double>(n_tracks)
+                             : 0.;
+    }
+    /// Mean relative momentum residual
+    double momentum_bias() const {
+        return n_matched_tracks > 0u
+                   ? sum_dp / static_cast<double>(n_matched_tracks)
+                   : 0.;
+    }
+    /// RMS of the relative momentum residual around its mean
+    double momentum_resolution() const {
+        if (n_matched_tracks == 0u) {
+            return 0.;
+        }
+        const double bias = momentum_bias();
+        return std::sqrt(std::max(
+            sum_dp2 / static_cast<double>(n_matched_tracks) - bias * bias,
+            0.));
+    }
+
+    /// Accumulate the performance of other events
+    tracking_performance& operator+=(const tracking_performance& other) {
+        n_particles += other.n_particles;
+        n_found_particles += other.n_found_particles;
+        n_tracks += other.n_tracks;
+        n_matched_tracks += other.n_matched_tracks;
+        sum_chi2_ndf += other.sum_chi2_ndf;
+        sum_dp += other.sum_dp;
+        sum_dp2 += other.sum_dp2;
+        return *this;
+    }
+
+};  // struct tracking_performance
+
+/// Truth particle of reconstructed measurements of a generated event
+///
+/// A reconstructed measurement belongs to the particle of the closest truth
+/// hit on the same module, if that is closer than @c max_distance.
+///
+class measurement_truth {
+
+    public:
+    /// Index the truth hits of @c event by module
+    explicit measurement_truth(const generated_event& event,
+                               scalar max_distance = 0.2f * unit<scalar>::mm)
+        : m_event(event), m_max_distance(max_distance) {
+        for (std::size_t i = 0; i < event.hits.size(); ++i) {
+            m_module_hits[event.measurements[i].surface_link.value()]
+                .push_back(i);
+        }
+    }
+
+    /// Index of the particle of @c meas, if it belongs to one
+    std::optional<std::size_t> particle_of(const measurement& meas) const {
+        const auto it = m_module_hits.find(meas.surface_link.value());
+        if (it == m_module_hits.end()) {
+            return std::nullopt;
+        }
+        std::optional<std::size_t> best;
+        scalar best_distance = m_max_distance * m_max_distance;
+        for (const std::size_t hit : it->second) {
+            const scalar d0 = meas.local[0] - m_event.hits[hit].local[0];
+            const scalar d1 = meas.local[1] - m_event.hits[hit].local[1];
+            if (d0 * d0 + d1 * d1 < best_distance) {
+                best_distance = d0 * d0 + d1 * d1;
+                best = m_event.hits[hit].particle;
+            }
+        }
+        return best;
+    }
+
+    private:
+    /// The generated event
+    const generated_event& m_event;
+    /// Largest distance of a measurement from its truth hit
+    scalar m_max_distance;
+    /// Truth hits on every module
+    std::unordered_map<std::uint64_t, std::vector<std::size_t>> m_module_hits;
+
+};  // class measurement_truth
+
+/// Compare the reconstructed tracks of a generated event with its truth
+///
+/// Measurements are matched to particles by @c measurement_truth. A track
+/// is matched to a particle if more than half of its measurements belong to
+/// that particle.
+///
+inline tracking_performance evaluate_performance(
+    const generated_event& event, const chain_result& result,
+    scalar max_distance = 0.2f * unit<scalar>::mm) {
+
+    const measurement_truth truth(event, max_distance);
+    std::vector<unsigned int> n_hits(event.particles.size(), 0u);
+    for (const truth_hit& hit : event.hits) {
+        ++n_hits[hit.particle];
+    }
+
+    tracking_performance perf;
+    std::vector<bool> found(event.particles.size(), false);
+    for (std::size_t i = 0; i < result.track_candidates.size(); ++i) {
+
+        // Fit outcome, from whichever fitter the chain used
+        double p = 0., chi2 = 0., ndf = 0.;
+        if (!result.batched_track_states.empty()) {
+            const auto& fit = result.batched_track_states[i];
+            p = static_cast<double>(fit.p());
+            chi2 = static_cast<double>(fit.chi2);
+            ndf = static_cast<double>(fit.ndf);
+        } else {
+            const auto& fit = result.track_states.at(i).header;
+            p = std::abs(1. / static_cast<double>(fit.fit_params.qop()));
+            chi2 = static_cast<double>(fit.chi2);
+            ndf = static_cast<double>(fit.ndf);
+        }
+        if (!(ndf > 0.)) {
+            continue;
+        }
+        ++perf.n_tracks;
+        perf.sum_chi2_ndf += chi2 / ndf;
+
+        // Majority particle of the track's measurements
+        const auto& items = result.track_candidates.at(i).items;
+        std::vector<std::pair<std::size_t, unsigned int>> counts;
+        for (const measurement& meas : items) {
+            const auto particle = truth.particle_of(meas);
+            if (!particle) {
+                continue;
+            }
+            auto it = std::find_if(
+                counts.begin(), counts.end(),
+                [&](const auto& c) { return c.first == *particle; });
+            if (it == counts.end()) {
+                counts.emplace_back(*particle, 1u);
+            } else {
+                ++it->second;
+            }
+        }
+        const auto majority = std::max_element(
+            counts.begin(), counts.end(),
+            [](const auto& a, const auto& b) { return a.second < b.second; });
+        if (majority == counts.end() || 2u * majority->second <= items.size()) {
+            continue;
+        }
+
+        ++perf.n_matched_tracks;
+        found[majority->first] = true;
+        const auto& mom = event.particles[majority->first].momentum;
+        const double p_true = std::sqrt(
+            static_cast<double>(mom[0]) * static_cast<double>(mom[0]) +
+            static_cast<double>(mom[1]) * static_cast<double>(mom[1]) +
+            static_cast<double>(mom[2]) * static_cast<double>(mom[2]));
+        const double dp = (p - p_true) / p_true;
+        perf.sum_dp += dp;
+        perf.sum_dp2 += dp * dp;
+    }
+
+    for (std::size_t i = 0; i < event.particles.size(); ++i) {
+        if (n_hits[i] >= 3u) {
+            ++perf.n_particles;
+            perf.n_found_particles += found[i] ? 1u : 0u;
+        }
+    }
+    return perf;
+}
+
+}  // namespace traccc::tutorial
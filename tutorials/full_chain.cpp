@@ -0,0 +1,717 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "common/arena_memory_resource.hpp"
+#include "common/cell_file.hpp"
+#include "common/detector_snapshot.hpp"
+#include "common/detector_utils.hpp"
+#include "common/event_generator.hpp"
+#include "common/instrumentation.hpp"
+#include "common/options.hpp"
+#include "common/pipeline.hpp"
+#include "common/precision.hpp"
+#include "common/reconstruction_chain.hpp"
+#include "common/stage_timer.hpp"
+#include "common/thread_pool.hpp"
+#include "common/track_state_file.hpp"
+#include "common/tracking_memory_resource.hpp"
+#include "common/tracking_performance.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+
+// detray include(s).
+#include "detray/detectors/bfield.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Event-independent inputs of a run, shared read-only by all workers
+struct run_setup {
+    const tutorial::chain_config& cfg;
+    const tutorial::reconstruction_chain::detector_type& det;
+    const silicon_detector_description::host& dd;
+    const tutorial::reconstruction_chain::field_type& field;
+    const tutorial::event_generator& generator;
+    /// Cell file to read the events from, instead of generating them
+    const tutorial::cell_file_reader* input;
+    std::size_t n_events;
+    bool use_arena;
+    /// Attribute the event data allocations to the stages
+    bool memory_report;
+    /// File to write the fitted tracks to, if any
+    tutorial::track_state_file_writer* output;
+};
+
+/// Summary of a run over all events
+struct run_summary {
+    tutorial::stage_times times;
+    tutorial::stage_times::duration wall_time{};
+    std::size_t n_tracks = 0;
+    /// Events whose upstream products came from the product cache
+    std::size_t n_cached_events = 0;
+    /// Physics performance, for generated events
+    tutorial::tracking_performance performance;
+    /// Fit iterations, with the adaptive fitting
+    tutorial::iteration_histogram fit_iterations;
+
+    /// @name Per-event memory statistics (with the arena resource)
+    /// @{
+    std::size_t bytes_allocated = 0;
+    std::size_t n_allocations = 0;
+    std::size_t high_water_mark = 0;
+    /// Upstream allocations after the first event of every worker
+    std::size_t steady_state_upstream_allocations = 0;
+    /// Allocations from the default memory resource, past the arenas, after
+    /// the first event of every worker
+    std::size_t steady_state_default_allocations = 0;
+    /// Events after the first event of every worker
+    std::size_t n_warm_events = 0;
+    /// @}
+
+    /// Allocations per stage, with the memory report
+    tutorial::memory_statistics stage_memory{};
+};
+
+/// Per-worker state: memory resource, algorithms and statistics
+struct alignas(64) worker_state {
+    worker_state(const run_setup& setup, tutorial::thread_pool* pool)
+        : arena(upstream_mr),
+          mr(setup.use_arena
+                 ? static_cast<vecmem::memory_resource&>(arena)
+                 : static_cast<vecmem::memory_resource&>(upstream_mr)),
+          tracking(mr),
+          event_mr(setup.memory_report
+                       ? static_cast<vecmem::memory_resource&>(tracking)
+                       : mr),
+          chain(setup.cfg, setup.det, setup.dd, setup.field, event_mr, pool) {
+    }
+
+    vecmem::host_memory_resource upstream_mr;
+    tutorial::arena_memory_resource arena;
+    vecmem::memory_resource& mr;
+    /// Attributes the allocations to the stages, with the memory report
+    tutorial::tracking_memory_resource tracking;
+    /// Resource of the event data
+    vecmem::memory_resource& event_mr;
+    tutorial::reconstruction_chain chain;
+    tutorial::stage_times times;
+    std::size_t n_events = 0;
+    std::size_t n_tracks = 0;
+    std::size_t n_cached_events = 0;
+    tutorial::tracking_performance performance;
+    tutorial::iteration_histogram fit_iterations;
+    run_summary memory;
+};
+
+/// Number of fitted tracks in the products of one event
+std::size_t n_fitted_tracks(const tutorial::chain_result& result) {
+    return result.track_states.size() +
+           static_cast<std::size_t>(std::count_if(
+               result.batched_track_states.begin(),
+               result.batched_track_states.end(),
+               [](const auto& track) { return track.ndf > 0u; }));
+}
+
+/// Queue the fitted tracks of one event for the output file, if there is one
+void write_tracks(const run_setup& setup, std::size_t event,
+                  const tutorial::chain_result& result) {
+    if (setup.output == nullptr) {
+        return;
+    }
+    if (setup.cfg.use_batched_fitter) {
+        setup.output->write(event, result.batched_track_states);
+    } else {
+        setup.output->write(event, result.track_states);
+    }
+}
+
+/// Process one event on the given worker
+void process_event(const run_setup& setup, std::size_t event,
+                   worker_state& worker) {
+    const std::size_t default_allocations =
+        tutorial::default_resource_counter::thread_allocations();
+    {
+        if (setup.input != nullptr) {
+            const auto result =
+                worker.chain(setup.input->event(event), worker.times);
+            write_tracks(setup, event, result);
+            worker.n_tracks += n_fitted_tracks(result);
+            worker.n_cached_events += result.from_cache;
+            worker.fit_iterations += result.fit_iterations;
+        } else {
+            const auto input = setup.generator(event, worker.event_mr);
+            const auto result = worker.chain(input.cells, worker.times);
+            write_tracks(setup, event, result);
+            worker.n_tracks += n_fitted_tracks(result);
+            worker.n_cached_events += result.from_cache;
+            worker.fit_iterations += result.fit_iterations;
+            worker.performance +=
+                tutorial::evaluate_performance(input, result);
+        }
+    }
+    ++worker.n_events;
+    if (setup.memory_report) {
+        worker.tracking.next_event();
+    }
+
+    // All event data is gone at this point, so the arena can be rewound.
+    if (setup.use_arena) {
+        const auto& stats = worker.arena.statistics();
+        worker.memory.bytes_allocated += stats.bytes_allocated;
+        worker.memory.n_allocations += stats.n_allocations;
+        worker.memory.high_water_mark =
+            std::max(worker.memory.high_water_mark, stats.high_water_mark);
+        if (worker.n_events > 1u) {
+            worker.memory.steady_state_upstream_allocations +=
+                stats.n_upstream_allocations;
+            worker.memory.steady_state_default_allocations +=
+                tutorial::default_resource_counter::thread_allocations() -
+                default_allocations;
+            ++worker.memory.n_warm_events;
+        }
+        worker.arena.reset();
+    }
+}
+
+/// Process all events, on @c n_threads threads
+///
+/// With a single thread the events are processed on the calling thread.
+/// Otherwise every event becomes one task of a work-stealing pool, and each
+/// worker uses its own memory resource and algorithm instances. The parallel
+/// clusterization, seeding and track finding submit their tasks to the same
+/// pool, where idle workers pick them up.
+///
+run_summary run_events(const run_setup& setup, std::size_t n_threads) {
+
+    std::optional<tutorial::thread_pool> pool;
+    if (n_threads > 1u) {
+        pool.emplace(n_threads);
+    }
+    std::vector<std::unique_ptr<worker_state>> workers;
+    for (std::size_t i = 0; i < std::max<std::size_t>(n_threads, 1u); ++i) {
+        workers.push_back(
+            std::make_unique<worker_state>(setup, pool ? &*pool : nullptr));
+    }
+
+    const auto start = tutorial::stage_times::clock::now();
+    if (!pool) {
+        for (std::size_t event = 0; event < setup.n_events; ++event) {
+            process_event(setup, event, *workers.front());
+        }
+    } else {
+        for (std::size_t event = 0; event < setup.n_events; ++event) {
+            pool->submit([&setup, &workers, event](std::size_t w) {
+                process_event(setup, event, *workers[w]);
+            });
+        }
+        pool->wait();
+    }
+
+    run_summary summary;
+    summary.wall_time = tutorial::stage_times::clock::now() - start;
+    for (const auto& worker : workers) {
+        summary.times += worker->times;
+        summary.n_tracks += worker->n_tracks;
+        summary.n_cached_events += worker->n_cached_events;
+        summary.performance += worker->performance;
+        summary.fit_iterations += worker->fit_iterations;
+        summary.bytes_allocated += worker->memory.bytes_allocated;
+        summary.n_allocations += worker->memory.n_allocations;
+        summary.high_water_mark = std::max(summary.high_water_mark,
+                                           worker->memory.high_water_mark);
+        summary.steady_state_upstream_allocations +=
+            worker->memory.steady_state_upstream_allocations;
+        summary.steady_state_default_allocations +=
+            worker->memory.steady_state_default_allocations;
+        summary.n_warm_events += worker->memory.n_warm_events;
+        summary.stage_memory += worker->tracking.statistics();
+    }
+    return summary;
+}
+
+/// An event on its way through the pipeline
+struct pipeline_event {
+    /// An event with its products on @c mr
+    explicit pipeline_event(vecmem::memory_resource& mr) : result(mr) {}
+
+    std::size_t index = 0;
+    /// The generated event, when not reading from a cell file
+    std::optional<tutorial::generated_event> generated;
+    /// The cells of the event
+    edm::silicon_cell_collection::const_view cells;
+    /// The products of the stages that the event passed
+    tutorial::chain_result result;
+};
+
+/// Process all events with a pipeline of stages
+///
+/// Every stage runs on its own group of threads, and the stages are joined
+/// by bounded queues, so a stage that runs ahead waits for the next one
+/// instead of piling up events. Events are read while the earlier ones are
+/// still reconstructed, and every compute stage thread owns its own chain,
+/// of which it only uses the algorithms of its stage.
+///
+/// Event data passes from one thread to another, so it is allocated from the
+/// host memory resource instead of from per-worker arenas.
+///
+run_summary run_pipeline(const run_setup& setup,
+                         const tutorial::pipeline_config& pcfg) {
+
+    using tutorial::pipeline_stage;
+    using event_ptr = std::unique_ptr<pipeline_event>;
+    const auto threads = [&pcfg](pipeline_stage s) {
+        return pcfg.threads[static_cast<std::size_t>(s)];
+    };
+
+    // Events in flight overlap, so the memory report has them all in its
+    // peaks, and measures the fragmentation over the whole run.
+    vecmem::host_memory_resource host_mr;
+    tutorial::tracking_memory_resource tracking(host_mr);
+    vecmem::memory_resource& mr =
+        setup.memory_report ? static_cast<vecmem::memory_resource&>(tracking)
+                            : host_mr;
+
+    // One chain and one set of stage times per compute thread
+    struct stage_worker {
+        stage_worker(const run_setup& setup, vecmem::memory_resource& mr)
+            : chain(setup.cfg, setup.det, setup.dd, setup.field, mr) {}
+        tutorial::reconstruction_chain chain;
+        tutorial::stage_times times;
+    };
+    std::array<std::vector<std::unique_ptr<stage_worker>>,
+               tutorial::n_pipeline_stages>
+        workers;
+    for (const pipeline_stage s :
+         {pipeline_stage::clusterization, pipeline_stage::seeding,
+          pipeline_stage::track_finding, pipeline_stage::track_fitting}) {
+        for (std::size_t i = 0; i < threads(s); ++i) {
+            workers[static_cast<std::size_t>(s)].push_back(
+                std::make_unique<stage_worker>(setup, mr));
+        }
+    }
+    const auto worker = [&workers](pipeline_stage s, std::size_t thread)
+        -> stage_worker& {
+        return *workers[static_cast<std::size_t>(s)][thread];
+    };
+    std::vector<run_summary> written(threads(pipeline_stage::write));
+
+    // The queues behind every stage but the last
+    std::vector<std::unique_ptr<tutorial::bounded_queue<event_ptr>>> queues;
+    for (std::size_t i = 0; i + 1u < tutorial::n_pipeline_stages; ++i) {
+        queues.push_back(std::make_unique<tutorial::bounded_queue<event_ptr>>(
+            pcfg.queue_capacity));
+    }
+    const auto queue = [&queues](pipeline_stage s)
+        -> tutorial::bounded_queue<event_ptr>& {
+        return *queues[static_cast<std::size_t>(s)];
+    };
+
+    // A failing stage closes all queues, so that the others stop too.
+    tutorial::pipeline_failure failure([&queues]() {
+        for (auto& q : queues) {
+            q->close();
+        }
+    });
+
+    const auto start = tutorial::stage_times::clock::now();
+    {
+        std::atomic<std::size_t> next_event{0u};
+        std::vector<tutorial::stage_group> stages;
+        stages.emplace_back(
+            threads(pipeline_stage::read),
+            [&](std::size_t) {
+                for (std::size_t i = next_event.fetch_add(1u);
+                     i < setup.n_events; i = next_event.fetch_add(1u)) {
+                    auto event = std::make_unique<pipeline_event>(mr);
+                    event->index = i;
+                    if (setup.input != nullptr) {
+                        event->cells = setup.input->event(i);
+                    } else {
+                        event->generated.emplace(setup.generator(i, mr));
+                        event->cells =
+                            vecmem::get_data(event->generated->cells);
+                    }
+                    if (!queue(pipeline_stage::read).push(std::move(event))) {
+                        return;
+                    }
+                }
+            },
+            [&]() { queue(pipeline_stage::read).close(); }, failure);
+        stages.push_back(tutorial::transform_stage(
+            threads(pipeline_stage::clusterization),
+            queue(pipeline_stage::read),
+            queue(pipeline_stage::clusterization),
+            [&](event_ptr& event, std::size_t t) {
+                auto& w = worker(pipeline_stage::clusterization, t);
+                w.chain.clusterize(event->cells, event->result, w.times);
+            },
+            failure));
+        stages.push_back(tutorial::transform_stage(
+            threads(pipeline_stage::seeding),
+            queue(pipeline_stage::clusterization),
+            queue(pipeline_stage::seeding),
+            [&](event_ptr& event, std::size_t t) {
+                auto& w = worker(pipeline_stage::seeding, t);
+                w.chain.seed(event->result, w.times);
+            },
+            failure));
+        stages.push_back(tutorial::transform_stage(
+            threads(pipeline_stage::track_finding),
+            queue(pipeline_stage::seeding),
+            queue(pipeline_stage::track_finding),
+            [&](event_ptr& event, std::size_t t) {
+                auto& w = worker(pipeline_stage::track_finding, t);
+                w.chain.find_tracks(event->result, w.times);
+            },
+            failure));
+        stages.push_back(tutorial::transform_stage(
+            threads(pipeline_stage::track_fitting),
+            queue(pipeline_stage::track_finding),
+            queue(pipeline_stage::track_fitting),
+            [&](event_ptr& event, std::size_t t) {
+                auto& w = worker(pipeline_stage::track_fitting, t);
+                w.chain.fit_tracks(event->result, w.times);
+            },
+            failure));
+        stages.emplace_back(
+            threads(pipeline_stage::write),
+            [&](std::size_t t) {
+                while (auto event = queue(pipeline_stage::track_fitting).pop()) {
+                    write_tracks(setup, (*event)->index, (*event)->result);
+                    written[t].n_tracks += n_fitted_tracks((*event)->result);
+                    written[t].n_cached_events +=
+                        (*event)->result.from_cache;
+                    written[t].fit_iterations +=
+                        (*event)->result.fit_iterations;
+                    if ((*event)->generated) {
+                        written[t].performance += tutorial::evaluate_performance(
+                            *(*event)->generated, (*event)->result);
+                    }
+                }
+            },
+            []() {}, failure);
+        // Leaving the scope joins the stages.
+    }
+    failure.rethrow();
+
+    run_summary summary;
+    summary.wall_time = tutorial::stage_times::clock::now() - start;
+    for (const auto& stage_workers : workers) {
+        for (const auto& w : stage_workers) {
+            summary.times += w->times;
+        }
+    }
+    for (const auto& w : written) {
+        summary.n_tracks += w.n_tracks;
+        summary.n_cached_events += w.n_cached_events;
+        summary.performance += w.performance;
+        summary.fit_iterations += w.fit_iterations;
+    }
+    summary.stage_memory = tracking.statistics();
+    return summary;
+}
+
+/// Print the throughput of the chain for an increasing number of threads
+void print_scaling_report(const run_setup& setup, std::size_t max_threads) {
+
+    std::vector<std::size_t> thread_counts;
+    for (std::size_t n = 1; n < max_threads; n *= 2) {
+        thread_counts.push_back(n);
+    }
+    thread_counts.push_back(max_threads);
+
+    std::cout << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "events/s"
+              << std::setw(10) << "speedup" << std::setw(12) << "efficiency"
+              << std::endl;
+    double reference = 0.;
+    for (const std::size_t n : thread_counts) {
+        const auto summary = run_events(setup, n);
+        const double rate =
+            static_cast<double>(setup.n_events) / summary.wall_time.count();
+        if (reference == 0.) {
+            reference = rate;
+        }
+        const double speedup = rate / reference;
+        std::cout << std::setw(8) << n << std::setw(14) << std::fixed
+                  << std::setprecision(1) << rate << std::setw(10)
+                  << std::setprecision(2) << speedup << std::setw(11)
+                  << std::setprecision(1)
+                  << 100. * speedup / static_cast<double>(n) << "%"
+                  << std::endl;
+    }
+    std::cout << std::defaultfloat << std::setprecision(6) << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const tutorial::options opts(argc, argv);
+    if (opts.help()) {
+        std::cout << "Usage: full_chain [--events=N] [--threads=N] [--scaling]"
+                  << " [--memory=arena|host] [--memory-report]" << std::endl
+                  << "                  [--snapshot=FILE] [--input=FILE]"
+                  << std::endl
+                  << "                  [--fitter=traccc|batched|smoother]"
+                  << " [--finding=traccc|parallel|telescope]" << std::endl
+                  << "                  [--ambiguity=none|greedy]"
+                  << " [--product-cache=DIR]" << std::endl
+                  << "                  [--clusterization=traccc|parallel]"
+                  << " [--seeding=traccc|grid]" << std::endl
+                  << "                  [--refit=fixed|adaptive]"
+                  << " [--iterations=N] [--refit-tolerance=X]" << std::endl
+                  << "                  [--pipeline]"
+                  << " [--pipeline-threads=R,C,S,F,T,W]"
+                  << " [--queue-capacity=N]" << std::endl
+                  << "                  [--instrumentation=FILE.json|FILE.csv]"
+                  << std::endl
+                  << "                  [--output=FILE]"
+                  << " [--output-compression=none|shuffle-rle]" << std::endl
+                  << "                  [--particles=N] [--p-min=GeV]"
+                  << " [--p-max=GeV] [--noise=N] [--cluster-radius=mm]"
+                  << " [--seed=N]" << std::endl;
+        return 0;
+    }
+    auto n_events = opts.get<std::size_t>("events", 100u);
+    const auto n_threads = opts.get<std::size_t>(
+        "threads", std::max(std::thread::hardware_concurrency(), 1u));
+    const bool pipelined = opts.flag("pipeline");
+    // Pipelined events move between threads, which the arenas do not allow.
+    const bool use_arena =
+        !pipelined && opts.get<std::string>("memory", "arena") == "arena";
+    // Count the allocations that bypass the arenas. Installed first, so that
+    // everything allocated through it is gone before it.
+    std::optional<tutorial::default_resource_counter> default_counter;
+    if (use_arena) {
+        default_counter.emplace();
+    }
+
+    /*******************************
+     * Read the telescope geometry
+     *******************************/
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the JSON files, or map a snapshot written by
+    // write_detector_snapshot.
+    using detector_type = tutorial::reconstruction_chain::detector_type;
+    const auto geometry_start = tutorial::stage_times::clock::now();
+    std::optional<decltype(tutorial::read_telescope_detector(host_mr))>
+        json_det;
+    std::optional<tutorial::detector_snapshot<detector_type>> snapshot;
+    const auto snapshot_file = opts.get<std::string>("snapshot", "");
+    if (snapshot_file.empty()) {
+        json_det.emplace(tutorial::read_telescope_detector(host_mr));
+    } else {
+        snapshot.emplace(snapshot_file);
+    }
+    const detector_type& host_det =
+        snapshot ? snapshot->detector() : json_det->first;
+    const tutorial::stage_times::duration geometry_time =
+        tutorial::stage_times::clock::now() - geometry_start;
+    std::cout << std::endl
+              << "Geometry loaded from "
+              << (snapshot ? "snapshot" : "JSON") << " in "
+              << geometry_time.count() * 1e3 << " ms" << std::endl;
+
+    const auto modules = tutorial::sensitive_modules(host_det);
+    const tutorial::pixel_readout readout;
+    const auto dd =
+        tutorial::make_detector_description(modules, host_mr, readout);
+
+    tutorial::chain_config cfg;
+    const auto fitter = opts.get<std::string>(
+        "fitter", cfg.use_batched_fitter ? "batched" : "traccc");
+    cfg.use_batched_fitter = (fitter == "batched" || fitter == "smoother");
+    cfg.use_filtered_smoothing = (fitter == "smoother");
+    cfg.use_parallel_clusterization =
+        opts.get<std::string>("clusterization", "traccc") == "parallel";
+    cfg.use_grid_seeding =
+        opts.get<std::string>("seeding", "traccc") == "grid";
+    const auto finding = opts.get<std::string>(
+        "finding", cfg.use_filtered_smoothing ? "telescope" : "traccc");
+    cfg.use_parallel_finding = (finding == "parallel");
+    cfg.use_telescope_finding = (finding == "telescope");
+    cfg.use_ambiguity_resolution =
+        opts.get<std::string>("ambiguity", "none") == "greedy";
+    cfg.use_adaptive_fitting =
+        opts.get<std::string>("refit", "fixed") == "adaptive";
+    cfg.fitting.n_iterations =
+        opts.get<unsigned int>("iterations", cfg.fitting.n_iterations);
+    cfg.adaptive_fitting.max_iterations = opts.get<unsigned int>(
+        "iterations", cfg.adaptive_fitting.max_iterations);
+    cfg.adaptive_fitting.parameter_tolerance = opts.get<scalar>(
+        "refit-tolerance", cfg.adaptive_fitting.parameter_tolerance);
+    cfg.product_cache = opts.get<std::string>("product-cache", "");
+    auto field = detray::bfield::create_const_field(cfg.B);
+
+    /*******************************
+     * Set up the event generator
+     *******************************/
+
+    const tutorial::event_generator generator(
+        tutorial::make_generator_config(opts), modules, readout, cfg.B);
+
+    // Events from a cell file written by write_cells, if one was given
+    std::optional<tutorial::cell_file_reader> input;
+    if (const auto input_file = opts.get<std::string>("input", "");
+        !input_file.empty()) {
+        input.emplace(input_file);
+        n_events = opts.flag("events") ? std::min(n_events, input->size())
+                                       : input->size();
+    }
+
+    // Fitted tracks are written by a background thread, as they come in.
+    // The scaling report runs the events several times, so it writes none.
+    std::optional<tutorial::track_state_file_writer> output;
+    const auto output_file = opts.get<std::string>("output", "");
+    if (!output_file.empty() && !opts.flag("scaling")) {
+        output.emplace(output_file,
+                       opts.get<std::string>("output-compression", "none") ==
+                               "shuffle-rle"
+                           ? tutorial::track_file_compression::shuffle_rle
+                           : tutorial::track_file_compression::none);
+    }
+
+    const run_setup setup{cfg,
+                          host_det,
+                          dd,
+                          field,
+                          generator,
+                          input ? &*input : nullptr,
+                          n_events,
+                          use_arena,
+                          opts.flag("memory-report"),
+                          output ? &*output : nullptr};
+
+    /*******************************
+     * Run the chain over the events
+     *******************************/
+
+    if (opts.flag("scaling")) {
+        print_scaling_report(setup, n_threads);
+        return 0;
+    }
+
+    const auto instrumentation_file =
+        opts.get<std::string>("instrumentation", "");
+    if (!instrumentation_file.empty() && !tutorial::instrumentation::enabled) {
+        std::cerr << "WARNING: built without TUTORIAL_ENABLE_INSTRUMENTATION,"
+                  << " " << instrumentation_file << " will only hold zeros"
+                  << std::endl;
+    }
+    tutorial::instrumentation::registry::instance().reset();
+
+    tutorial::pipeline_config pipeline_cfg;
+    if (opts.flag("pipeline-threads")) {
+        pipeline_cfg.threads = tutorial::pipeline_config::parse_threads(
+            opts.get<std::string>("pipeline-threads", ""));
+    } else if (pipelined) {
+        pipeline_cfg = tutorial::pipeline_config::for_threads(n_threads);
+    }
+    pipeline_cfg.queue_capacity =
+        opts.get<std::size_t>("queue-capacity", pipeline_cfg.queue_capacity);
+
+    const auto summary = pipelined ? run_pipeline(setup, pipeline_cfg)
+                                   : run_events(setup, n_threads);
+
+    std::cout << std::endl
+              << "Precision: " << tutorial::precision_name << std::endl
+              << "Threads: " << n_threads << std::endl;
+    if (pipelined) {
+        std::cout << "Pipeline threads:";
+        for (std::size_t s = 0; s < tutorial::n_pipeline_stages; ++s) {
+            std::cout << " " << tutorial::pipeline_stage_name(
+                                    static_cast<tutorial::pipeline_stage>(s))
+                      << "=" << pipeline_cfg.threads[s];
+        }
+        std::cout << std::endl;
+    }
+    tutorial::print_stage_report(std::cout, summary.times, n_events,
+                                 summary.wall_time);
+    std::cout << "Fitted tracks per event: "
+              << static_cast<double>(summary.n_tracks) /
+                     static_cast<double>(std::max<std::size_t>(n_events, 1u))
+              << std::endl;
+    if (!cfg.product_cache.empty()) {
+        std::cout << "Events loaded from the product cache: "
+                  << summary.n_cached_events << " of " << n_events
+                  << std::endl;
+    }
+    if (summary.fit_iterations.n_tracks() > 0u) {
+        std::cout << std::endl;
+        summary.fit_iterations.print(std::cout);
+    }
+    if (!input) {
+        const auto& perf = summary.performance;
+        std::cout << "Track finding efficiency: " << perf.efficiency()
+                  << std::endl;
+        std::cout << "Mean chi2/NDF: " << perf.mean_chi2_ndf() << std::endl;
+        std::cout << "Momentum bias: " << perf.momentum_bias() << std::endl;
+        std::cout << "Momentum resolution: " << perf.momentum_resolution()
+                  << std::endl;
+    }
+    if (use_arena && n_events > 0u) {
+        std::cout << "Arena bytes allocated per event: "
+                  << summary.bytes_allocated / n_events << std::endl;
+        std::cout << "Arena allocations per event: "
+                  << summary.n_allocations / n_events << std::endl;
+        std::cout << "Arena high-water mark per event (max): "
+                  << summary.high_water_mark << " bytes" << std::endl;
+        std::cout << "Upstream blocks taken by the arenas after warm-up: "
+                  << summary.steady_state_upstream_allocations << std::endl;
+        if (summary.steady_state_upstream_allocations > 0u) {
+            std::cerr << "WARNING: the arenas allocated from the heap after"
+                      << " the first event of a worker "
+                      << summary.steady_state_upstream_allocations
+                      << " time(s); an event needed more memory than all"
+                      << " earlier ones" << std::endl;
+        }
+        std::cout << "Default resource allocations per event after warm-up"
+                  << " (past the arenas): "
+                  << summary.steady_state_default_allocations /
+                         std::max<std::size_t>(summary.n_warm_events, 1u)
+                  << std::endl;
+    }
+    if (setup.memory_report) {
+        tutorial::print_memory_report(std::cout, summary.stage_memory,
+                                      n_events);
+    }
+    if (output) {
+        output->close();
+        std::cout << "Fitted tracks written to " << output_file << " ("
+                  << output->bytes_written() << " bytes)" << std::endl;
+    }
+    if (!instrumentation_file.empty()) {
+        tutorial::instrumentation::write(instrumentation_file);
+        std::cout << "Instrumentation written to " << instrumentation_file
+                  << std::endl;
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "common/options.hpp"
+#include "common/track_state_file.hpp"
+
+// System include(s).
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+using namespace traccc;
+
+int main(int argc, char* argv[])
+{
+    const tutorial::options opts(argc, argv);
+    if (opts.help()) {
+        std::cout << "Usage: read_track_states [--input=FILE]" << std::endl;
+        return 0;
+    }
+    const auto input = opts.get<std::string>("input", "tracks.bin");
+
+    /*******************************
+     * Map the track state file
+     *******************************/
+
+    const tutorial::track_state_file_reader reader(input);
+
+    /*******************************
+     * Summarize the fitted tracks
+     *******************************/
+
+    std::size_t n_tracks = 0, n_fitted = 0, n_states = 0, n_holes = 0;
+    double chi2_ndf_sum = 0., residual2_sum[2] = {0., 0.};
+    for (std::size_t i = 0; i < reader.size(); ++i) {
+        const auto event = reader.event(i);
+        n_tracks += event.n_tracks();
+        for (std::size_t t = 0; t < event.n_tracks(); ++t) {
+            if (event.ndf()[t] > 0.f) {
+                chi2_ndf_sum += event.chi2()[t] / event.ndf()[t];
+                ++n_fitted;
+            }
+        }
+        for (std::size_t s = 0; s < event.n_states(); ++s) {
+            if (event.state_hole()[s] != 0u) {
+                ++n_holes;
+                continue;
+            }
+            for (std::size_t d = 0; d < 2u; ++d) {
+                const double r = event.state_residual()[s][d];
+                residual2_sum[d] += r * r;
+            }
+            ++n_states;
+        }
+    }
+
+    std::cout << std::endl;
+    std::cout << "Events: " << reader.size() << std::endl;
+    std::cout << "Tracks: " << n_tracks << std::endl;
+    std::cout << "Mean chi2/NDF: "
+              << (n_fitted > 0u ? chi2_ndf_sum / static_cast<double>(n_fitted)
+                                : 0.)
+              << std::endl;
+    std::cout << "Measurement states: " << n_states << " (and " << n_holes
+              << " holes)" << std::endl;
+    if (n_states > 0u) {
+        std::cout << "Residual RMS [mm]: "
+                  << std::sqrt(residual2_sum[0] /
+                               static_cast<double>(n_states))
+                  << ", "
+                  << std::sqrt(residual2_sum[1] /
+                               static_cast<double>(n_states))
+                  << std::endl;
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "common/cell_file.hpp"
+#include "common/event_socket.hpp"
+#include "common/options.hpp"
+#include "common/stage_timer.hpp"
+#include "common/track_state_file.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace traccc;
+
+int main(int argc, char* argv[])
+{
+    const tutorial::options opts(argc, argv);
+    if (opts.help()) {
+        std::cout << "Usage: reconstruction_client [--socket=PATH]"
+                  << " [--input=FILE] [--events=N] [--batch=N]" << std::endl
+                  << "                             [--output=FILE]"
+                  << " [--shutdown]" << std::endl;
+        return 0;
+    }
+    const auto socket_path =
+        opts.get<std::string>("socket", "/tmp/traccc_tutorial.sock");
+    const auto batch_size =
+        std::max<std::size_t>(opts.get<std::size_t>("batch", 1u), 1u);
+
+    auto socket = tutorial::event_socket::connect(socket_path);
+    if (opts.flag("shutdown") && !opts.flag("input")) {
+        tutorial::send_shutdown(socket);
+        return 0;
+    }
+
+    /*******************************
+     * Map the events to send
+     *******************************/
+
+    const auto input = opts.get<std::string>("input", "cells.bin");
+    const tutorial::cell_file_reader reader(input);
+    const std::size_t n_events =
+        std::min(opts.get<std::size_t>("events", reader.size()),
+                 reader.size());
+
+    std::optional<tutorial::track_state_file_writer> output;
+    const auto output_file = opts.get<std::string>("output", "");
+    if (!output_file.empty()) {
+        output.emplace(output_file);
+    }
+
+    /*******************************
+     * Send the events in batches
+     *******************************/
+
+    // Round trip of every request, and the daemon's share of it
+    std::vector<tutorial::stage_times::duration> latencies;
+    double reconstruction_time = 0.;
+    std::size_t n_tracks = 0, n_failed = 0;
+    std::vector<edm::silicon_cell_collection::const_view> batch;
+    for (std::size_t first = 0; first < n_events; first += batch_size) {
+        batch.clear();
+        for (std::size_t i = first;
+             i < std::min(first + batch_size, n_events); ++i) {
+            batch.push_back(reader.event(i));
+        }
+
+        const auto start = tutorial::stage_times::clock::now();
+        tutorial::send_request(socket, first, batch);
+        std::vector<tutorial::event_response> responses;
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            responses.push_back(tutorial::receive_response(socket));
+        }
+        latencies.push_back(tutorial::stage_times::clock::now() - start);
+
+        for (auto& response : responses) {
+            reconstruction_time += response.reconstruction_time;
+            n_tracks += response.tracks.n_tracks();
+            n_failed += !response.ok;
+            if (output) {
+                output->write(std::move(response.tracks));
+            }
+        }
+    }
+    if (opts.flag("shutdown")) {
+        tutorial::send_shutdown(socket);
+    }
+    if (output) {
+        output->close();
+    }
+
+    std::cout << std::endl;
+    std::cout << "Events: " << n_events << " in " << latencies.size()
+              << " requests" << std::endl;
+    std::cout << "Tracks per event: "
+              << static_cast<double>(n_tracks) /
+                     static_cast<double>(std::max<std::size_t>(n_events, 1u))
+              << std::endl;
+    if (n_failed > 0u) {
+        std::cout << "Failed events: " << n_failed << std::endl;
+    }
+    tutorial::print_latency_report(std::cout, "request", latencies);
+    std::cout << "Reconstruction time per event [ms]: "
+              << reconstruction_time * 1e3 /
+                     static_cast<double>(std::max<std::size_t>(n_events, 1u))
+              << std::endl;
+    if (output) {
+        std::cout << "Fitted tracks written to " << output_file << std::endl;
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,225 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "common/arena_memory_resource.hpp"
+#include "common/detector_snapshot.hpp"
+#include "common/detector_utils.hpp"
+#include "common/event_socket.hpp"
+#include "common/options.hpp"
+#include "common/reconstruction_chain.hpp"
+#include "common/stage_timer.hpp"
+#include "common/thread_pool.hpp"
+#include "common/track_state_file.hpp"
+
+// detray include(s).
+#include "detray/detectors/bfield.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Per-worker memory resource and chain, kept for the daemon's lifetime
+struct alignas(64) daemon_worker {
+    daemon_worker(const tutorial::chain_config& cfg,
+                  const tutorial::reconstruction_chain::detector_type& det,
+                  const silicon_detector_description::host& dd,
+                  const tutorial::reconstruction_chain::field_type& field)
+        : arena(upstream_mr), chain(cfg, det, dd, field, arena) {}
+
+    vecmem::host_memory_resource upstream_mr;
+    tutorial::arena_memory_resource arena;
+    tutorial::reconstruction_chain chain;
+    tutorial::stage_times times;
+};
+
+/// Answer to one event of a request
+struct event_answer {
+    tutorial::track_state_table tracks;
+    double reconstruction_time = 0.;
+    bool ok = true;
+};
+
+/// Reconstruct event @c i of a request on the given worker
+event_answer reconstruct(const tutorial::chain_config& cfg,
+                         const tutorial::event_request& request,
+                         std::size_t i, daemon_worker& worker) {
+    event_answer answer;
+    const auto start = tutorial::stage_times::clock::now();
+    try {
+        const auto result = worker.chain(request.cells(i), worker.times);
+        answer.tracks =
+            cfg.use_batched_fitter
+                ? tutorial::make_track_state_table(
+                      request.events[i], result.batched_track_states)
+                : tutorial::make_track_state_table(request.events[i],
+                                                   result.track_states);
+    } catch (const std::exception& e) {
+        std::cerr << "Event " << request.events[i] << " failed: " << e.what()
+                  << std::endl;
+        answer.tracks = {};
+        answer.tracks.event = request.events[i];
+        answer.ok = false;
+    }
+    // The table has its own storage, so the arena can be rewound.
+    worker.arena.reset();
+    answer.reconstruction_time =
+        tutorial::stage_times::duration(tutorial::stage_times::clock::now() -
+                                        start)
+            .count();
+    return answer;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const tutorial::options opts(argc, argv);
+    if (opts.help()) {
+        std::cout << "Usage: reconstruction_daemon [--socket=PATH]"
+                  << " [--threads=N] [--snapshot=FILE]"
+                  << " [--fitter=traccc|batched]" << std::endl;
+        return 0;
+    }
+    const auto socket_path =
+        opts.get<std::string>("socket", "/tmp/traccc_tutorial.sock");
+    const auto n_threads = opts.get<std::size_t>(
+        "threads", std::max(std::thread::hardware_concurrency(), 1u));
+
+    /*******************************
+     * Load everything once
+     *******************************/
+
+    const auto startup = tutorial::stage_times::clock::now();
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    using detector_type = tutorial::reconstruction_chain::detector_type;
+    std::optional<decltype(tutorial::read_telescope_detector(host_mr))>
+        json_det;
+    std::optional<tutorial::detector_snapshot<detector_type>> snapshot;
+    const auto snapshot_file = opts.get<std::string>("snapshot", "");
+    if (snapshot_file.empty()) {
+        json_det.emplace(tutorial::read_telescope_detector(host_mr));
+    } else {
+        snapshot.emplace(snapshot_file);
+    }
+    const detector_type& host_det =
+        snapshot ? snapshot->detector() : json_det->first;
+
+    const auto modules = tutorial::sensitive_modules(host_det);
+    const auto dd = tutorial::make_detector_description(
+        modules, host_mr, tutorial::pixel_readout{});
+
+    tutorial::chain_config cfg;
+    cfg.use_batched_fitter =
+        opts.get<std::string>("fitter", cfg.use_batched_fitter
+                                            ? "batched"
+                                            : "traccc") == "batched";
+    const auto field = detray::bfield::create_const_field(cfg.B);
+
+    // One chain per worker; requests only ever run events through them.
+    std::optional<tutorial::thread_pool> pool;
+    if (n_threads > 1u) {
+        pool.emplace(n_threads);
+    }
+    std::vector<std::unique_ptr<daemon_worker>> workers;
+    for (std::size_t i = 0; i < std::max<std::size_t>(n_threads, 1u); ++i) {
+        workers.push_back(
+            std::make_unique<daemon_worker>(cfg, host_det, dd, field));
+    }
+
+    tutorial::event_socket_listener listener(socket_path);
+    const tutorial::stage_times::duration startup_time =
+        tutorial::stage_times::clock::now() - startup;
+    std::cout << std::endl
+              << "Geometry, field and " << workers.size()
+              << " chains set up in " << startup_time.count() * 1e3 << " ms"
+              << std::endl
+              << "Listening at " << socket_path << std::endl;
+
+    /*******************************
+     * Serve requests
+     *******************************/
+
+    // Time from the complete request to the last byte of the answer
+    std::vector<tutorial::stage_times::duration> latencies;
+    std::size_t n_events = 0;
+    bool stop = false;
+    while (!stop) {
+        tutorial::event_socket client = listener.accept();
+        try {
+            while (auto request = tutorial::receive_request(client)) {
+                if (request->type == tutorial::request_type::shutdown) {
+                    stop = true;
+                    break;
+                }
+                const auto start = tutorial::stage_times::clock::now();
+                std::vector<event_answer> answers(request->size());
+                if (!pool) {
+                    for (std::size_t i = 0; i < request->size(); ++i) {
+                        answers[i] =
+                            reconstruct(cfg, *request, i, *workers.front());
+                    }
+                } else {
+                    for (std::size_t i = 0; i < request->size(); ++i) {
+                        pool->submit([&, i](std::size_t w) {
+                            answers[i] =
+                                reconstruct(cfg, *request, i, *workers[w]);
+                        });
+                    }
+                    pool->wait();
+                }
+                for (const auto& answer : answers) {
+                    tutorial::send_response(client, answer.tracks,
+                                            answer.reconstruction_time,
+                                            answer.ok);
+                }
+                latencies.push_back(tutorial::stage_times::clock::now() -
+                                    start);
+                n_events += request->size();
+            }
+        } catch (const std::exception& e) {
+            // A broken client does not take the daemon down.
+            std::cerr << "Dropped a client: " << e.what() << std::endl;
+        }
+    }
+
+    /*******************************
+     * Summarize the served requests
+     *******************************/
+
+    tutorial::stage_times times;
+    for (const auto& worker : workers) {
+        times += worker->times;
+    }
+    tutorial::stage_times::duration busy_time{};
+    for (const auto& latency : latencies) {
+        busy_time += latency;
+    }
+    std::cout << std::endl
+              << "Served " << latencies.size() << " requests with "
+              << n_events << " events" << std::endl;
+    tutorial::print_latency_report(std::cout, "request", latencies);
+    tutorial::print_stage_report(std::cout, times, n_events, busy_time);
+
+    return 0;
+}
@@ -107,6 +107,8 @@ int main()
     fit_cfg.propagation.stepping.rk_error_tol = 1e-8f * unit<float>::mm;
     //@TIP: Kalman fitter can be repeated to obtain more precise result
     //fit_cfg.n_iterations = 2;
+    //@TIP: ...or only for the tracks that have not converged yet, with
+    //tutorial::adaptive_kalman_fitting (see common/adaptive_fitting.hpp)
     fit_cfg.use_backward_filter = true;
     traccc::host::kalman_fitting_algorithm fitting(fit_cfg, host_mr);
 
@@ -116,6 +118,10 @@ int main()
     // Run fitting
     auto track_states =
         fitting(host_det, field, traccc::get_data(track_candidates));
+    //@TIP: All fitted parameters, covariances and residuals can be stored in
+    //a columnar binary file with tutorial::track_state_file_writer, and read
+    //back with tutorial::track_state_file_reader
+    //(see common/track_state_file.hpp)
 
     const scalar q = -1.f;
 
@@ -0,0 +1,70 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "common/cell_file.hpp"
+#include "common/detector_utils.hpp"
+#include "common/event_generator.hpp"
+#include "common/options.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <iostream>
+#include <string>
+
+using namespace traccc;
+
+int main(int argc, char* argv[])
+{
+    const tutorial::options opts(argc, argv);
+    if (opts.help()) {
+        std::cout << "Usage: write_cells [--output=FILE] [--events=N]"
+                  << " [--particles=N] [--p-min=GeV] [--p-max=GeV]"
+                  << " [--noise=N] [--cluster-radius=mm] [--seed=N]"
+                  << std::endl;
+        return 0;
+    }
+    const auto output = opts.get<std::string>("output", "cells.bin");
+    const auto n_events = opts.get<std::size_t>("events", 100u);
+
+    /*******************************
+     * Set up the event generator
+     *******************************/
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    const auto [host_det, names] = tutorial::read_telescope_detector(host_mr);
+    const auto modules = tutorial::sensitive_modules(host_det);
+
+    const vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    const tutorial::event_generator generator(
+        tutorial::make_generator_config(opts), modules, {}, B);
+
+    /*******************************
+     * Write the cells of the events
+     *******************************/
+
+    tutorial::cell_file_writer writer(output);
+    std::size_t n_cells = 0;
+    for (std::size_t event = 0; event < n_events; ++event) {
+        const auto generated = generator(event, host_mr);
+        writer.write(generated.cells);
+        n_cells += generated.cells.size();
+    }
+    writer.close();
+
+    std::cout << "Wrote " << n_events << " events with " << n_cells
+              << " cells to " << output << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "common/detector_snapshot.hpp"
+#include "common/detector_utils.hpp"
+#include "common/options.hpp"
+
+// traccc include(s).
+#include "traccc/geometry/detector.hpp"
+
+// detray include(s).
+#include "detray/io/frontend/detector_reader.hpp"
+
+// System include(s).
+#include <iostream>
+#include <string>
+
+using namespace traccc;
+
+int main(int argc, char* argv[])
+{
+    const tutorial::options opts(argc, argv);
+    if (opts.help()) {
+        std::cout << "Usage: write_detector_snapshot [--output=FILE]"
+                  << std::endl;
+        return 0;
+    }
+    const auto output =
+        opts.get<std::string>("output", "telescope_detector.snapshot");
+
+    /*******************************************************
+     * Read the JSON geometry into a snapshot image and
+     * write the image to disk
+     *******************************************************/
+
+    const std::size_t size =
+        tutorial::detector_snapshot<traccc::default_detector::host>::write(
+            output, [](vecmem::memory_resource& mr) {
+                auto [det, names] =
+                    detray::io::read_detector<traccc::default_detector::host>(
+                        mr, tutorial::telescope_reader_config());
+                return std::move(det);
+            });
+
+    std::cout << "Wrote " << size << " bytes to " << output << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+/** TRACCC tutorial for beginners
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "common/field_map.hpp"
+#include "common/options.hpp"
+
+// traccc include(s).
+#include "traccc/definitions/common.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+using namespace traccc;
+
+int main(int argc, char* argv[])
+{
+    const tutorial::options opts(argc, argv);
+    if (opts.help()) {
+        std::cout << "Usage: write_field_map [--output=FILE] [--bz=T]"
+                  << " [--gradient=T/m] [--spacing=mm]" << std::endl;
+        return 0;
+    }
+    const auto output = opts.get<std::string>("output", "field_map.bin");
+    // Field along z at x = 0, and its change along the telescope axis
+    const double bz = opts.get("bz", 2.) * unit<double>::T;
+    const double gradient =
+        opts.get("gradient", 0.) * unit<double>::T / unit<double>::m;
+    const double spacing = opts.get("spacing", 20.) * unit<double>::mm;
+
+    /*******************************************************
+     * Sample the field on a grid around the telescope
+     *******************************************************/
+
+    // The telescope planes are at 0 <= x <= 400 mm
+    const double x_min = -100. * unit<double>::mm;
+    const double x_max = 500. * unit<double>::mm;
+    const double yz_half_width = 1000. * unit<double>::mm;
+
+    tutorial::field_grid grid;
+    grid.min = {x_min, -yz_half_width, -yz_half_width};
+    grid.spacing = {spacing, spacing, spacing};
+    grid.n = {static_cast<std::uint64_t>((x_max - x_min) / spacing) + 1u,
+              static_cast<std::uint64_t>(2. * yz_half_width / spacing) + 1u,
+              static_cast<std::uint64_t>(2. * yz_half_width / spacing) + 1u};
+
+    tutorial::field_map::write(output, grid, [&](const point3& pos) {
+        return vector3{0.f, 0.f,
+                       static_cast<scalar>(bz + gradient * pos[0])};
+    });
+
+    std::cout << "Wrote a " << grid.n[0] << " x " << grid.n[1] << " x "
+              << grid.n[2] << " field map to " << output << std::endl;
+
+    return 0;
+}